@@ -57,6 +57,9 @@
 /// These generators are based on Vigna, Sebastiano (2014). "An
 /// experimental exploration of Marsaglia's xorshift generators,
 /// scrambled."  See: http://arxiv.org/abs/1402.6246
+///
+/// The counter-based generators are based on Salmon et al. (2011).
+/// "Parallel random numbers: as easy as 1, 2, 3."
 
 namespace Kokkos {
 
@@ -90,6 +93,11 @@ namespace Kokkos {
     in contrast to CuRand none of the functions of the pool (or the generator) are collectives,
     i.e. all functions can be called inside conditionals.
 
+    The counter-based generators Random_Philox4x32 and Random_Threefry4x64 do not need a pool.
+    They are constructed from (seed, stream, counter) wherever they are needed, e.g., from the
+    work index inside a kernel, so their results do not depend on the thread count or backend.
+    Their pools only adapt them to the state-pool interface.
+
     template<class Device>
     class Pool {
      public:
@@ -105,10 +113,16 @@ namespace Kokkos {
       Pool(unsigned int seed);
 
       //Initialize Pool with seed as a starting seed with a pool_size of num_states
-      //The Random_XorShift64 generator is used in serial to initialize all states,
+      //The states are expanded from the seed in parallel by SplitMix64,
       //thus the initialization process is platform independent and deterministic.
+      //A seed gives different streams than with the serial initialization of
+      //Kokkos 3.1 and earlier.
       void init(unsigned int seed, int num_states);
 
+      //Random_XorShift1024_Pool only: initialize the states as non-overlapping
+      //substreams of 2^512 draws, state i beginning substream first_substream + i.
+      void init_substreams(unsigned int seed, int num_states, uint64_t first_substream = 0);
+
       //Get a generator. This will lock one of the states, guaranteeing that each thread
       //will have its private generator. Note: on Cuda getting a state involves atomics,
       //and is thus not deterministic!
@@ -674,6 +688,161 @@ struct Random_UniqueIndex<Kokkos::Experimental::HIP> {
 };
 #endif
 
+/// \brief Expand a seed into the n-th value of the SplitMix64 sequence of
+///   Steele, Lea, and Flood (2014).  States of a pool are initialized
+///   from these values in parallel.
+KOKKOS_INLINE_FUNCTION
+uint64_t random_splitmix64(const uint64_t seed, const uint64_t n) {
+  uint64_t z = seed + (n + 1) * 0x9E3779B97F4A7C15ULL;
+  z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+/// \brief Advance the xorshift1024 recurrence by one step.
+template <class StateType>
+KOKKOS_INLINE_FUNCTION void random_xorshift1024_next(StateType& state,
+                                                     int& p) {
+  uint64_t state_0 = state[p];
+  uint64_t state_1 = state[p = (p + 1) & 15];
+  state_1 ^= state_1 << 31;
+  state_1 ^= state_1 >> 11;
+  state_0 ^= state_0 >> 30;
+  state[p] = state_0 ^ state_1;
+}
+
+/// \brief Jump the xorshift1024 recurrence ahead by N steps, where
+///   poly = x^N modulo the characteristic polynomial of the recurrence.
+///
+/// See Haramoto, Matsumoto, Nishimura, Panneton, and L'Ecuyer (2008).
+/// "Efficient jump ahead for F2-linear random number generators."
+template <class StateType>
+KOKKOS_INLINE_FUNCTION void random_xorshift1024_jump(StateType& state,
+                                                     int& p,
+                                                     const uint64_t poly[16]) {
+  uint64_t t[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  for (int i = 0; i < 16; ++i) {
+    for (int b = 0; b < 64; ++b) {
+      if ((poly[i] >> b) & 1) {
+        for (int j = 0; j < 16; ++j) t[j] ^= state[(j + p) & 15];
+      }
+      random_xorshift1024_next(state, p);
+    }
+  }
+  for (int j = 0; j < 16; ++j) state[(j + p) & 15] = t[j];
+}
+
+/// \brief Jump polynomial x^(2^512) of xorshift1024, which separates
+///   consecutive substreams.
+struct Random_XorShift1024_Jump {
+  uint64_t poly[16];
+
+  KOKKOS_INLINE_FUNCTION
+  Random_XorShift1024_Jump()
+      : poly{0x84242f96eca9c41dULL, 0xa3c65b8776f96855ULL,
+             0x5b34a39f070b5837ULL, 0x4489affce4f31a1eULL,
+             0x2ffeeb0a48316f40ULL, 0xdc2d9891fe68c022ULL,
+             0x3659132bb12fea70ULL, 0xaac17d8efa43cab8ULL,
+             0xc4cb815590989b13ULL, 0x5ee975283d71c93bULL,
+             0x691548c86c1bd540ULL, 0x7910c41d10a1e6a5ULL,
+             0x0b5fc64563b3e2a8ULL, 0x047f7684e9fc949dULL,
+             0xb99181f2d8f685caULL, 0x284600e3f30e38c3ULL} {}
+
+  /// \brief Square the polynomial modulo the characteristic polynomial of
+  ///   xorshift1024, doubling the length of the jump.
+  inline void square() {
+    // Characteristic polynomial, lowest coefficient first, with the
+    // leading x^1024 term as the last word.
+    const uint64_t charpoly[17] = {
+        0x1000000000000001ULL, 0x2200aa001400f000ULL, 0x0111e1c02bc18180ULL,
+        0x030d535201556130ULL, 0x4a32d044029b08f7ULL, 0x34b3216457d7b028ULL,
+        0xe860f083d70158c6ULL, 0xdf6a7cadba32bca9ULL, 0xbabab341e2554b59ULL,
+        0xcd40a7e2537771eaULL, 0x0040f0e46e848800ULL, 0xa1422cb7814f5c68ULL,
+        0x53116c08605c805fULL, 0x0440024003007b28ULL, 0x787878786d381540ULL,
+        0x0000000000007879ULL, 0x0000000000000001ULL};
+
+    // Squaring over GF(2) spreads the coefficients to the even powers
+    uint64_t sq[32] = {0};
+    for (int i = 0; i < 1024; ++i) {
+      if ((poly[i >> 6] >> (i & 63)) & 1) {
+        sq[(2 * i) >> 6] |= uint64_t(1) << ((2 * i) & 63);
+      }
+    }
+
+    for (int d = 2047; 1024 <= d; --d) {
+      if ((sq[d >> 6] >> (d & 63)) & 1) {
+        const int w = (d - 1024) >> 6;
+        const int b = (d - 1024) & 63;
+        for (int i = 0; i < 17; ++i) {
+          sq[i + w] ^= charpoly[i] << b;
+          if (b && i + w + 1 < 32) sq[i + w + 1] ^= charpoly[i] >> (64 - b);
+        }
+      }
+    }
+
+    for (int i = 0; i < 16; ++i) poly[i] = sq[i];
+  }
+};
+
+template <class StateViewType>
+struct Random_XorShift64_Init {
+  StateViewType state;
+  uint64_t seed;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    const uint64_t s = random_splitmix64(seed, i);
+    state(i)         = s == 0 ? uint64_t(1318319) : s;
+  }
+};
+
+template <class StateViewType>
+struct Random_XorShift1024_Init {
+  StateViewType state;
+  uint64_t seed;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    for (int j = 0; j < 16; ++j) {
+      state(i, j) = random_splitmix64(seed, 16 * i + j);
+    }
+  }
+};
+
+template <class StateViewType>
+struct Random_XorShift1024_Assign {
+  StateViewType state;
+  uint64_t value[16];
+
+  Random_XorShift1024_Assign(const StateViewType& state_,
+                             const uint64_t value_[16], const int p)
+      : state(state_) {
+    for (int j = 0; j < 16; ++j) value[j] = value_[(j + p) & 15];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    for (int j = 0; j < 16; ++j) state(i, j) = value[j];
+  }
+};
+
+// Substream of state i + offset begins one jump after that of state i
+template <class StateViewType>
+struct Random_XorShift1024_Substream {
+  StateViewType state;
+  Random_XorShift1024_Jump jump;
+  int offset;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    uint64_t s[16];
+    int p = 0;
+    for (int j = 0; j < 16; ++j) s[j] = state(i, j);
+    random_xorshift1024_jump(s, p, jump.poly);
+    for (int j = 0; j < 16; ++j) state(i + offset, j) = s[(j + p) & 15];
+  }
+};
+
 }  // namespace Impl
 
 template <class DeviceType>
@@ -860,6 +1029,8 @@ class Random_XorShift64_Pool {
     return *this;
   }
 
+  // The states are expanded from the seed in parallel, thus the
+  // initialization is platform independent and deterministic.
   void init(uint64_t seed, int num_states) {
     if (seed == 0) seed = uint64_t(1318319);
 
@@ -868,26 +1039,9 @@ class Random_XorShift64_Pool {
     locks_ = locks_type("Kokkos::Random_XorShift64::locks", num_states_);
     state_ = state_data_type("Kokkos::Random_XorShift64::state", num_states_);
 
-    typename state_data_type::HostMirror h_state = create_mirror_view(state_);
-    typename locks_type::HostMirror h_lock       = create_mirror_view(locks_);
-
-    // Execute on the HostMirror's default execution space.
-    Random_XorShift64<typename state_data_type::HostMirror::execution_space>
-        gen(seed, 0);
-    for (int i = 0; i < 17; i++) gen.rand();
-    for (int i = 0; i < num_states_; i++) {
-      int n1     = gen.rand();
-      int n2     = gen.rand();
-      int n3     = gen.rand();
-      int n4     = gen.rand();
-      h_state(i) = (((static_cast<uint64_t>(n1)) & 0xffff) << 00) |
-                   (((static_cast<uint64_t>(n2)) & 0xffff) << 16) |
-                   (((static_cast<uint64_t>(n3)) & 0xffff) << 32) |
-                   (((static_cast<uint64_t>(n4)) & 0xffff) << 48);
-      h_lock(i) = 0;
-    }
-    deep_copy(state_, h_state);
-    deep_copy(locks_, h_lock);
+    parallel_for("Kokkos::Random_XorShift64::init",
+                 RangePolicy<execution_space>(0, num_states_),
+                 Impl::Random_XorShift64_Init<state_data_type>{state_, seed});
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -936,6 +1090,13 @@ class Random_XorShift1024 {
                       int state_idx = 0)
       : p_(p), state_idx_(state_idx), state_(state, state_idx) {}
 
+  /// \brief Advance by 2^512 draws, to the start of the next substream.
+  KOKKOS_INLINE_FUNCTION
+  void jump() {
+    Impl::random_xorshift1024_jump(state_, p_,
+                                   Impl::Random_XorShift1024_Jump().poly);
+  }
+
   KOKKOS_INLINE_FUNCTION
   uint32_t urand() {
     uint64_t state_0 = state_[p_];
@@ -1081,6 +1242,13 @@ class Random_XorShift1024_Pool {
   int num_states_;
   friend class Random_XorShift1024<DeviceType>;
 
+  void allocate(int num_states) {
+    num_states_ = num_states;
+    locks_      = locks_type("Kokkos::Random_XorShift1024::locks", num_states_);
+    state_ = state_data_type("Kokkos::Random_XorShift1024::state", num_states_);
+    p_     = int_view_type("Kokkos::Random_XorShift1024::p", num_states_);
+  }
+
  public:
   typedef Random_XorShift1024<DeviceType> generator_type;
 
@@ -1111,37 +1279,58 @@ class Random_XorShift1024_Pool {
     return *this;
   }
 
+  // The states are expanded from the seed in parallel, thus the
+  // initialization is platform independent and deterministic.
   inline void init(uint64_t seed, int num_states) {
     if (seed == 0) seed = uint64_t(1318319);
-    num_states_ = num_states;
-    locks_      = locks_type("Kokkos::Random_XorShift1024::locks", num_states_);
-    state_ = state_data_type("Kokkos::Random_XorShift1024::state", num_states_);
-    p_     = int_view_type("Kokkos::Random_XorShift1024::p", num_states_);
+    allocate(num_states);
+
+    parallel_for(
+        "Kokkos::Random_XorShift1024::init",
+        RangePolicy<execution_space>(0, num_states_),
+        Impl::Random_XorShift1024_Init<state_data_type>{state_, seed});
+  }
+
+  /// \brief Initialize the states as non-overlapping substreams of 2^512
+  ///   draws of the one sequence determined by seed.
+  ///
+  /// State i begins substream first_substream + i, e.g., pass
+  /// first_substream = rank * num_states to partition the sequence across
+  /// the ranks of a distributed run.  The substreams are derived by
+  /// polynomial jump-ahead, one jump per state, in log2(num_states)
+  /// parallel steps.
+  inline void init_substreams(uint64_t seed, int num_states,
+                              uint64_t first_substream = 0) {
+    if (seed == 0) seed = uint64_t(1318319);
+    allocate(num_states);
 
-    typename state_data_type::HostMirror h_state = create_mirror_view(state_);
-    typename locks_type::HostMirror h_lock       = create_mirror_view(locks_);
-    typename int_view_type::HostMirror h_p       = create_mirror_view(p_);
-
-    // Execute on the HostMirror's default execution space.
-    Random_XorShift64<typename state_data_type::HostMirror::execution_space>
-        gen(seed, 0);
-    for (int i = 0; i < 17; i++) gen.rand();
-    for (int i = 0; i < num_states_; i++) {
-      for (int j = 0; j < 16; j++) {
-        int n1        = gen.rand();
-        int n2        = gen.rand();
-        int n3        = gen.rand();
-        int n4        = gen.rand();
-        h_state(i, j) = (((static_cast<uint64_t>(n1)) & 0xffff) << 00) |
-                        (((static_cast<uint64_t>(n2)) & 0xffff) << 16) |
-                        (((static_cast<uint64_t>(n3)) & 0xffff) << 32) |
-                        (((static_cast<uint64_t>(n4)) & 0xffff) << 48);
+    // Jump the first state ahead on the host, one jump per bit
+    uint64_t first[16];
+    int p = 0;
+    for (int j = 0; j < 16; ++j) first[j] = Impl::random_splitmix64(seed, j);
+
+    Impl::Random_XorShift1024_Jump jump;
+    for (; first_substream; first_substream >>= 1, jump.square()) {
+      if (first_substream & 1) {
+        Impl::random_xorshift1024_jump(first, p, jump.poly);
       }
-      h_p(i)    = 0;
-      h_lock(i) = 0;
     }
-    deep_copy(state_, h_state);
-    deep_copy(locks_, h_lock);
+
+    parallel_for("Kokkos::Random_XorShift1024::init_substreams",
+                 RangePolicy<execution_space>(0, 1),
+                 Impl::Random_XorShift1024_Assign<state_data_type>(
+                     state_, first, p));
+
+    // States [0,n) are jumped to states [n,2n)
+    jump = Impl::Random_XorShift1024_Jump();
+    for (int n = 1; n < num_states_; n *= 2, jump.square()) {
+      parallel_for(
+          "Kokkos::Random_XorShift1024::init_substreams",
+          RangePolicy<execution_space>(
+              0, n < num_states_ - n ? n : num_states_ - n),
+          Impl::Random_XorShift1024_Substream<state_data_type>{state_, jump,
+                                                               n});
+    }
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -1165,6 +1354,551 @@ class Random_XorShift1024_Pool {
   }
 };
 
+/// \class Random_Philox4x32
+/// \brief Counter-based Philox4x32-10 generator.
+///
+/// See Salmon, Moraes, Dror, and Shaw (2011). "Parallel random numbers:
+/// as easy as 1, 2, 3."  The numbers are a pure function of
+/// (seed, stream, counter) so the generator needs neither a pool nor
+/// locks.  Constructing the generator inside a kernel from the work
+/// index, e.g. Random_Philox4x32<Device> gen(seed, i), gives bitwise
+/// identical results on every backend and for every thread count.
+/// Each evaluation of the bijection yields four 32-bit values.
+template <class DeviceType>
+class Random_Philox4x32 {
+ private:
+  uint32_t key_[2];
+  uint32_t ctr_[4];
+  uint32_t out_[4];
+  int idx_;
+
+  KOKKOS_INLINE_FUNCTION
+  static uint32_t mulhilo(const uint32_t a, const uint32_t b, uint32_t& hi) {
+    const uint64_t product = static_cast<uint64_t>(a) * b;
+    hi                     = static_cast<uint32_t>(product >> 32);
+    return static_cast<uint32_t>(product);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void next_block(uint32_t out[4]) {
+    bijection(key_, ctr_, out);
+    if (0 == ++ctr_[0]) ++ctr_[1];
+  }
+
+ public:
+  typedef DeviceType device_type;
+
+  constexpr static uint32_t MAX_URAND   = std::numeric_limits<uint32_t>::max();
+  constexpr static uint64_t MAX_URAND64 = std::numeric_limits<uint64_t>::max();
+  constexpr static int32_t MAX_RAND     = std::numeric_limits<int32_t>::max();
+  constexpr static int64_t MAX_RAND64   = std::numeric_limits<int64_t>::max();
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Philox4x32(uint64_t seed, uint64_t stream = 0, uint64_t counter = 0)
+      : idx_(4) {
+    key_[0] = static_cast<uint32_t>(seed);
+    key_[1] = static_cast<uint32_t>(seed >> 32);
+    ctr_[0] = static_cast<uint32_t>(counter);
+    ctr_[1] = static_cast<uint32_t>(counter >> 32);
+    ctr_[2] = static_cast<uint32_t>(stream);
+    ctr_[3] = static_cast<uint32_t>(stream >> 32);
+  }
+
+  /// \brief The ten round Philox bijection of one counter block.
+  KOKKOS_INLINE_FUNCTION
+  static void bijection(const uint32_t key[2], const uint32_t ctr[4],
+                        uint32_t out[4]) {
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+    uint32_t c0 = ctr[0];
+    uint32_t c1 = ctr[1];
+    uint32_t c2 = ctr[2];
+    uint32_t c3 = ctr[3];
+    for (int r = 0; r < 10; ++r) {
+      if (r) {
+        k0 += 0x9E3779B9U;
+        k1 += 0xBB67AE85U;
+      }
+      uint32_t hi0, hi1;
+      const uint32_t lo0 = mulhilo(0xD2511F53U, c0, hi0);
+      const uint32_t lo1 = mulhilo(0xCD9E8D57U, c2, hi1);
+      c0                 = hi1 ^ c1 ^ k0;
+      c1                 = lo1;
+      c2                 = hi0 ^ c3 ^ k1;
+      c3                 = lo0;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+  }
+
+  /// \brief Counter of the next block to be generated.
+  KOKKOS_INLINE_FUNCTION
+  uint64_t counter() const {
+    return (static_cast<uint64_t>(ctr_[1]) << 32) | ctr_[0];
+  }
+
+  /// \brief Draw the four values of the next counter block.
+  ///   Values buffered by urand() are neither used nor discarded.
+  KOKKOS_INLINE_FUNCTION
+  void urand4(uint32_t out[4]) { next_block(out); }
+
+  /// \brief Draw four floats in the range [0,1.0) from the next counter block.
+  KOKKOS_INLINE_FUNCTION
+  void frand4(float out[4]) {
+    uint32_t tmp[4];
+    next_block(tmp);
+    // The upper 24 bits fill the mantissa exactly
+    for (int i = 0; i < 4; ++i) {
+      out[i] = (tmp[i] >> 8) * (1.0f / 16777216.0f);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand() {
+    if (4 == idx_) {
+      next_block(out_);
+      idx_ = 0;
+    }
+    return out_[idx_++];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64() {
+    const uint64_t lo = urand();
+    return (static_cast<uint64_t>(urand()) << 32) | lo;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& range) {
+    const uint32_t max_val = (MAX_URAND / range) * range;
+    uint32_t tmp           = urand();
+    while (tmp >= max_val) tmp = urand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& start, const uint32_t& end) {
+    return urand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& range) {
+    const uint64_t max_val = (MAX_URAND64 / range) * range;
+    uint64_t tmp           = urand64();
+    while (tmp >= max_val) tmp = urand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& start, const uint64_t& end) {
+    return urand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand() { return static_cast<int>(urand() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& range) {
+    const int max_val = (MAX_RAND / range) * range;
+    int tmp           = rand();
+    while (tmp >= max_val) tmp = rand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& start, const int& end) {
+    return rand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64() { return static_cast<int64_t>(urand64() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& range) {
+    const int64_t max_val = (MAX_RAND64 / range) * range;
+    int64_t tmp           = rand64();
+    while (tmp >= max_val) tmp = rand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& start, const int64_t& end) {
+    return rand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand() { return urand64() / static_cast<float>(MAX_URAND64); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& range) {
+    return range * urand64() / static_cast<float>(MAX_URAND64);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& start, const float& end) {
+    return frand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand() { return urand64() / static_cast<double>(MAX_URAND64); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& range) {
+    return range * urand64() / static_cast<double>(MAX_URAND64);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& start, const double& end) {
+    return drand(end - start) + start;
+  }
+
+  // Marsaglia polar method for drawing a standard normal distributed random
+  // number
+  KOKKOS_INLINE_FUNCTION
+  double normal() {
+#ifndef __HIP_DEVICE_COMPILE__  // FIXME_HIP
+    using std::sqrt;
+#else
+    using ::sqrt;
+#endif
+    double S = 2.0;
+    double U;
+    while (S >= 1.0) {
+      U              = 2.0 * drand() - 1.0;
+      const double V = 2.0 * drand() - 1.0;
+      S              = U * U + V * V;
+    }
+    return U * sqrt(-2.0 * log(S) / S);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double normal(const double& mean, const double& std_dev = 1.0) {
+    return mean + normal() * std_dev;
+  }
+};
+
+/// \class Random_Philox4x32_Pool
+/// \brief State-pool interface to Random_Philox4x32.
+///
+/// get_state(stream) is stateless and reproducible.  get_state() hands
+/// out the next unused stream from an atomic counter for use with code
+/// written against the state-pool concept, e.g., fill_random; which
+/// stream a thread receives then depends on scheduling.
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+class Random_Philox4x32_Pool {
+ private:
+  typedef View<uint64_t, DeviceType> stream_type;
+
+  stream_type next_stream_;
+  uint64_t seed_;
+
+ public:
+  typedef Random_Philox4x32<DeviceType> generator_type;
+  typedef DeviceType device_type;
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Philox4x32_Pool() : seed_(0) {}
+
+  Random_Philox4x32_Pool(uint64_t seed) { init(seed, 0); }
+
+  // The number of states is ignored: any number of streams may be active
+  void init(uint64_t seed, int /*num_states*/) {
+    seed_        = seed;
+    next_stream_ = stream_type("Kokkos::Random_Philox4x32::next_stream");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  generator_type get_state() const {
+    return generator_type(
+        seed_, Kokkos::atomic_fetch_add(&next_stream_(), uint64_t(1)));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  generator_type get_state(const uint64_t stream) const {
+    return generator_type(seed_, stream);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void free_state(const generator_type&) const {}
+};
+
+/// \class Random_Threefry4x64
+/// \brief Counter-based Threefry4x64-20 generator.
+///
+/// See Salmon, Moraes, Dror, and Shaw (2011). "Parallel random numbers:
+/// as easy as 1, 2, 3."  As with Random_Philox4x32 the numbers are a pure
+/// function of (seed, stream, counter).  Threefry needs only adds,
+/// rotations, and xors, and each evaluation of the bijection yields
+/// four 64-bit values.
+template <class DeviceType>
+class Random_Threefry4x64 {
+ private:
+  uint64_t key_[4];
+  uint64_t ctr_;
+  uint64_t out_[4];
+  int idx_;
+
+  KOKKOS_INLINE_FUNCTION
+  static uint64_t rotl(const uint64_t x, const int n) {
+    return (x << n) | (x >> (64 - n));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void next_block(uint64_t out[4]) {
+    const uint64_t ctr[4] = {ctr_++, 0, 0, 0};
+    bijection(key_, ctr, out);
+  }
+
+ public:
+  typedef DeviceType device_type;
+
+  constexpr static uint32_t MAX_URAND   = std::numeric_limits<uint32_t>::max();
+  constexpr static uint64_t MAX_URAND64 = std::numeric_limits<uint64_t>::max();
+  constexpr static int32_t MAX_RAND     = std::numeric_limits<int32_t>::max();
+  constexpr static int64_t MAX_RAND64   = std::numeric_limits<int64_t>::max();
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Threefry4x64(uint64_t seed, uint64_t stream = 0, uint64_t counter = 0)
+      : ctr_(counter), idx_(4) {
+    key_[0] = seed;
+    key_[1] = stream;
+    key_[2] = 0;
+    key_[3] = 0;
+  }
+
+  /// \brief The twenty round Threefry bijection of one counter block.
+  KOKKOS_INLINE_FUNCTION
+  static void bijection(const uint64_t key[4], const uint64_t ctr[4],
+                        uint64_t out[4]) {
+    constexpr int rotation[8][2] = {{14, 16}, {52, 57}, {23, 40}, {5, 37},
+                                    {25, 33}, {46, 12}, {58, 22}, {32, 32}};
+
+    const uint64_t ks[5] = {
+        key[0], key[1], key[2], key[3],
+        0x1BD11BDAA9FC1A22ULL ^ key[0] ^ key[1] ^ key[2] ^ key[3]};
+
+    uint64_t x0 = ctr[0] + ks[0];
+    uint64_t x1 = ctr[1] + ks[1];
+    uint64_t x2 = ctr[2] + ks[2];
+    uint64_t x3 = ctr[3] + ks[3];
+
+    for (int r = 0; r < 20; ++r) {
+      const int* const rot = rotation[r % 8];
+      if (0 == r % 2) {
+        x0 += x1;
+        x1 = rotl(x1, rot[0]) ^ x0;
+        x2 += x3;
+        x3 = rotl(x3, rot[1]) ^ x2;
+      } else {
+        x0 += x3;
+        x3 = rotl(x3, rot[0]) ^ x0;
+        x2 += x1;
+        x1 = rotl(x1, rot[1]) ^ x2;
+      }
+      if (3 == r % 4) {
+        // Key injection
+        const int s = (r + 1) / 4;
+        x0 += ks[s % 5];
+        x1 += ks[(s + 1) % 5];
+        x2 += ks[(s + 2) % 5];
+        x3 += ks[(s + 3) % 5] + s;
+      }
+    }
+    out[0] = x0;
+    out[1] = x1;
+    out[2] = x2;
+    out[3] = x3;
+  }
+
+  /// \brief Counter of the next block to be generated.
+  KOKKOS_INLINE_FUNCTION
+  uint64_t counter() const { return ctr_; }
+
+  /// \brief Draw the four values of the next counter block.
+  ///   Values buffered by urand64() are neither used nor discarded.
+  KOKKOS_INLINE_FUNCTION
+  void urand64_4(uint64_t out[4]) { next_block(out); }
+
+  /// \brief Draw four doubles in the range [0,1.0) from the next counter
+  ///   block.
+  KOKKOS_INLINE_FUNCTION
+  void drand4(double out[4]) {
+    uint64_t tmp[4];
+    next_block(tmp);
+    // The upper 53 bits fill the mantissa exactly
+    for (int i = 0; i < 4; ++i) {
+      out[i] = (tmp[i] >> 11) * (1.0 / 9007199254740992.0);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64() {
+    if (4 == idx_) {
+      next_block(out_);
+      idx_ = 0;
+    }
+    return out_[idx_++];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand() { return static_cast<uint32_t>(urand64() >> 32); }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& range) {
+    const uint32_t max_val = (MAX_URAND / range) * range;
+    uint32_t tmp           = urand();
+    while (tmp >= max_val) tmp = urand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& start, const uint32_t& end) {
+    return urand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& range) {
+    const uint64_t max_val = (MAX_URAND64 / range) * range;
+    uint64_t tmp           = urand64();
+    while (tmp >= max_val) tmp = urand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& start, const uint64_t& end) {
+    return urand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand() { return static_cast<int>(urand() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& range) {
+    const int max_val = (MAX_RAND / range) * range;
+    int tmp           = rand();
+    while (tmp >= max_val) tmp = rand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& start, const int& end) {
+    return rand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64() { return static_cast<int64_t>(urand64() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& range) {
+    const int64_t max_val = (MAX_RAND64 / range) * range;
+    int64_t tmp           = rand64();
+    while (tmp >= max_val) tmp = rand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& start, const int64_t& end) {
+    return rand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand() { return urand64() / static_cast<float>(MAX_URAND64); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& range) {
+    return range * urand64() / static_cast<float>(MAX_URAND64);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& start, const float& end) {
+    return frand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand() { return urand64() / static_cast<double>(MAX_URAND64); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& range) {
+    return range * urand64() / static_cast<double>(MAX_URAND64);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& start, const double& end) {
+    return drand(end - start) + start;
+  }
+
+  // Marsaglia polar method for drawing a standard normal distributed random
+  // number
+  KOKKOS_INLINE_FUNCTION
+  double normal() {
+#ifndef __HIP_DEVICE_COMPILE__  // FIXME_HIP
+    using std::sqrt;
+#else
+    using ::sqrt;
+#endif
+    double S = 2.0;
+    double U;
+    while (S >= 1.0) {
+      U              = 2.0 * drand() - 1.0;
+      const double V = 2.0 * drand() - 1.0;
+      S              = U * U + V * V;
+    }
+    return U * sqrt(-2.0 * log(S) / S);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double normal(const double& mean, const double& std_dev = 1.0) {
+    return mean + normal() * std_dev;
+  }
+};
+
+/// \class Random_Threefry4x64_Pool
+/// \brief State-pool interface to Random_Threefry4x64.
+///
+/// get_state(stream) is stateless and reproducible.  get_state() hands
+/// out the next unused stream from an atomic counter for use with code
+/// written against the state-pool concept, e.g., fill_random; which
+/// stream a thread receives then depends on scheduling.
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+class Random_Threefry4x64_Pool {
+ private:
+  typedef View<uint64_t, DeviceType> stream_type;
+
+  stream_type next_stream_;
+  uint64_t seed_;
+
+ public:
+  typedef Random_Threefry4x64<DeviceType> generator_type;
+  typedef DeviceType device_type;
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Threefry4x64_Pool() : seed_(0) {}
+
+  Random_Threefry4x64_Pool(uint64_t seed) { init(seed, 0); }
+
+  // The number of states is ignored: any number of streams may be active
+  void init(uint64_t seed, int /*num_states*/) {
+    seed_        = seed;
+    next_stream_ = stream_type("Kokkos::Random_Threefry4x64::next_stream");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  generator_type get_state() const {
+    return generator_type(
+        seed_, Kokkos::atomic_fetch_add(&next_stream_(), uint64_t(1)));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  generator_type get_state(const uint64_t stream) const {
+    return generator_type(seed_, stream);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void free_state(const generator_type&) const {}
+};
+
 namespace Impl {
 
 template <class ViewType, class RandomPool, int loops, int rank,
@@ -1735,6 +2469,366 @@ void fill_random(ViewType a, RandomPool g,
                                                      ViewType::Rank, IndexType>(
                      a, g, begin, end));
 }
+
+//----------------------------------------------------------------------------
+// Distributions for bulk generation with fill_random.
+//
+// A distribution draws a single value with operator()(gen) and a block of
+// block_size values with generate(gen, out).  Where the transform has no
+// rejection step, generate() first draws all uniform deviates and then
+// transforms them in a separate loop without data-dependent branches so
+// that the compiler may vectorize the transform.
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+/// \brief Uniform deviate in the open interval (0,1), safe for log().
+template <class Generator>
+KOKKOS_INLINE_FUNCTION double uniform_open(Generator& gen) {
+  return ((gen.urand64() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+/// \brief Standard normal deviate by the Box-Muller transform.
+template <class Generator>
+KOKKOS_INLINE_FUNCTION double standard_normal(Generator& gen) {
+  using std::cos;
+  using std::log;
+  using std::sqrt;
+  const double u = uniform_open(gen);
+  const double v = uniform_open(gen);
+  return sqrt(-2.0 * log(u)) * cos(6.283185307179586 * v);
+}
+
+template <class Distribution>
+struct is_random_distribution : public std::false_type {};
+
+}  // namespace Impl
+
+/// \brief Normal distribution with the given mean and standard deviation,
+///   by the Box-Muller transform.
+template <class Scalar = double>
+struct normal_distribution {
+  typedef Scalar value_type;
+  enum : int { block_size = 16 };
+
+  Scalar mean;
+  Scalar stddev;
+
+  KOKKOS_INLINE_FUNCTION
+  normal_distribution(const Scalar& mean_ = 0, const Scalar& stddev_ = 1)
+      : mean(mean_), stddev(stddev_) {}
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION Scalar operator()(Generator& gen) const {
+    return mean + stddev * Impl::standard_normal(gen);
+  }
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION void generate(Generator& gen,
+                                       Scalar out[block_size]) const {
+    using std::cos;
+    using std::log;
+    using std::sin;
+    using std::sqrt;
+    double u[block_size];
+    for (int i = 0; i < block_size; ++i) u[i] = Impl::uniform_open(gen);
+    for (int i = 0; i < block_size; i += 2) {
+      const double r     = sqrt(-2.0 * log(u[i]));
+      const double theta = 6.283185307179586 * u[i + 1];
+      out[i]             = mean + stddev * r * cos(theta);
+      out[i + 1]         = mean + stddev * r * sin(theta);
+    }
+  }
+};
+
+/// \brief Exponential distribution with the given rate, by inversion.
+template <class Scalar = double>
+struct exponential_distribution {
+  typedef Scalar value_type;
+  enum : int { block_size = 16 };
+
+  Scalar rate;
+
+  KOKKOS_INLINE_FUNCTION
+  exponential_distribution(const Scalar& rate_ = 1) : rate(rate_) {}
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION Scalar operator()(Generator& gen) const {
+    using std::log;
+    return -log(Impl::uniform_open(gen)) / rate;
+  }
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION void generate(Generator& gen,
+                                       Scalar out[block_size]) const {
+    using std::log;
+    double u[block_size];
+    for (int i = 0; i < block_size; ++i) u[i] = Impl::uniform_open(gen);
+    for (int i = 0; i < block_size; ++i) out[i] = -log(u[i]) / rate;
+  }
+};
+
+/// \brief Gamma distribution with the given shape and scale.
+///
+/// See Marsaglia and Tsang (2000). "A simple method for generating gamma
+/// variables."
+template <class Scalar = double>
+struct gamma_distribution {
+  typedef Scalar value_type;
+  enum : int { block_size = 16 };
+
+  Scalar shape;
+  Scalar scale;
+
+  KOKKOS_INLINE_FUNCTION
+  gamma_distribution(const Scalar& shape_ = 1, const Scalar& scale_ = 1)
+      : shape(shape_), scale(scale_) {}
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION Scalar operator()(Generator& gen) const {
+    using std::log;
+    using std::pow;
+    using std::sqrt;
+
+    // Shape below one is boosted by one and corrected by a power of a
+    // uniform deviate.
+    const bool boost = shape < 1;
+    const double d   = (boost ? shape + 1.0 : double(shape)) - 1.0 / 3.0;
+    const double c   = 1.0 / sqrt(9.0 * d);
+
+    double value = 0;
+    for (bool done = false; !done;) {
+      const double x = Impl::standard_normal(gen);
+      double v       = 1.0 + c * x;
+      if (v <= 0) continue;
+      v              = v * v * v;
+      const double u = Impl::uniform_open(gen);
+      done           = log(u) < 0.5 * x * x + d - d * v + d * log(v);
+      value          = d * v;
+    }
+    if (boost) value *= pow(Impl::uniform_open(gen), 1.0 / shape);
+    return scale * value;
+  }
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION void generate(Generator& gen,
+                                       Scalar out[block_size]) const {
+    for (int i = 0; i < block_size; ++i) out[i] = (*this)(gen);
+  }
+};
+
+/// \brief Poisson distribution with the given mean.
+///
+/// Small means use multiplication of uniform deviates, large means the
+/// transformed rejection of Hormann (1993). "The transformed rejection
+/// method for generating Poisson random variables."
+template <class Scalar = int64_t>
+struct poisson_distribution {
+  typedef Scalar value_type;
+  enum : int { block_size = 16 };
+
+  double mean;
+
+  KOKKOS_INLINE_FUNCTION
+  poisson_distribution(const double& mean_ = 1) : mean(mean_) {}
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION Scalar operator()(Generator& gen) const {
+    using std::exp;
+    using std::floor;
+    using std::lgamma;
+    using std::log;
+    using std::sqrt;
+
+    if (mean < 10) {
+      const double limit = exp(-mean);
+      int64_t k          = 0;
+      for (double p = Impl::uniform_open(gen); limit < p;
+           p *= Impl::uniform_open(gen)) {
+        ++k;
+      }
+      return static_cast<Scalar>(k);
+    }
+
+    const double smu       = sqrt(mean);
+    const double b         = 0.931 + 2.53 * smu;
+    const double a         = -0.059 + 0.02483 * b;
+    const double inv_alpha = 1.1239 + 1.1328 / (b - 3.4);
+    const double vr        = 0.9277 - 3.6224 / (b - 2);
+    const double log_mean  = log(mean);
+
+    while (true) {
+      const double u  = Impl::uniform_open(gen) - 0.5;
+      const double v  = Impl::uniform_open(gen);
+      const double us = 0.5 - (u < 0 ? -u : u);
+      const double k  = floor((2 * a / us + b) * u + mean + 0.43);
+      if (us >= 0.07 && v <= vr) return static_cast<Scalar>(k);
+      if (k < 0 || (us < 0.013 && v > us)) continue;
+      if (log(v) + log(inv_alpha) - log(a / (us * us) + b) <=
+          -mean + k * log_mean - lgamma(k + 1)) {
+        return static_cast<Scalar>(k);
+      }
+    }
+  }
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION void generate(Generator& gen,
+                                       Scalar out[block_size]) const {
+    for (int i = 0; i < block_size; ++i) out[i] = (*this)(gen);
+  }
+};
+
+/// \brief Normal distribution truncated to the interval [lower,upper].
+///   Either bound may be infinite.
+///
+/// See Robert (1995). "Simulation of truncated normal variables."
+template <class Scalar = double>
+struct truncated_normal_distribution {
+  typedef Scalar value_type;
+  enum : int { block_size = 16 };
+
+  Scalar mean;
+  Scalar stddev;
+  Scalar lower;
+  Scalar upper;
+
+  KOKKOS_INLINE_FUNCTION
+  truncated_normal_distribution(const Scalar& mean_, const Scalar& stddev_,
+                                const Scalar& lower_, const Scalar& upper_)
+      : mean(mean_), stddev(stddev_), lower(lower_), upper(upper_) {}
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION Scalar operator()(Generator& gen) const {
+    using std::exp;
+    using std::log;
+    using std::sqrt;
+
+    // Standardize, and reflect an interval below zero to above zero
+    double a          = (lower - mean) / stddev;
+    double b          = (upper - mean) / stddev;
+    const bool mirror = b <= 0;
+    if (mirror) {
+      const double tmp = a;
+      a                = -b;
+      b                = -tmp;
+    }
+
+    double z = 0;
+    if (a < 0) {
+      if (2.5066282746310002 <= b - a) {
+        // Wide interval about zero: reject normal deviates
+        do {
+          z = Impl::standard_normal(gen);
+        } while (z < a || b < z);
+      } else {
+        // Narrow interval about zero: uniform proposal
+        do {
+          z = a + (b - a) * Impl::uniform_open(gen);
+        } while (exp(-0.5 * z * z) < Impl::uniform_open(gen));
+      }
+    } else {
+      const double alpha = 0.5 * (a + sqrt(a * a + 4));
+      if ((b - a) * alpha < 1) {
+        // Short tail interval: uniform proposal
+        do {
+          z = a + (b - a) * Impl::uniform_open(gen);
+        } while (exp(0.5 * (a * a - z * z)) < Impl::uniform_open(gen));
+      } else {
+        // Tail: translated exponential proposal
+        double rho = 0;
+        do {
+          z              = a - log(Impl::uniform_open(gen)) / alpha;
+          const double d = z - alpha;
+          rho            = b < z ? 0 : exp(-0.5 * d * d);
+        } while (rho < Impl::uniform_open(gen));
+      }
+    }
+
+    return mean + stddev * (mirror ? -z : z);
+  }
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION void generate(Generator& gen,
+                                       Scalar out[block_size]) const {
+    for (int i = 0; i < block_size; ++i) out[i] = (*this)(gen);
+  }
+};
+
+namespace Impl {
+
+template <class Scalar>
+struct is_random_distribution<normal_distribution<Scalar> >
+    : public std::true_type {};
+template <class Scalar>
+struct is_random_distribution<exponential_distribution<Scalar> >
+    : public std::true_type {};
+template <class Scalar>
+struct is_random_distribution<gamma_distribution<Scalar> >
+    : public std::true_type {};
+template <class Scalar>
+struct is_random_distribution<poisson_distribution<Scalar> >
+    : public std::true_type {};
+template <class Scalar>
+struct is_random_distribution<truncated_normal_distribution<Scalar> >
+    : public std::true_type {};
+
+template <class ViewType, class RandomPool, class Distribution, int loops>
+struct fill_random_distribution_functor {
+  typedef typename ViewType::execution_space execution_space;
+  typedef typename Distribution::value_type value_type;
+  enum : int { block_size = Distribution::block_size };
+
+  ViewType a;
+  RandomPool rand_pool;
+  Distribution dist;
+
+  fill_random_distribution_functor(ViewType a_, RandomPool rand_pool_,
+                                   Distribution dist_)
+      : a(a_), rand_pool(rand_pool_), dist(dist_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i) const {
+    const int64_t n     = a.extent(0);
+    const int64_t begin = i * loops;
+    const int64_t end   = begin + loops < n ? begin + loops : n;
+
+    typename RandomPool::generator_type gen = rand_pool.get_state();
+    value_type block[block_size];
+    for (int64_t idx = begin; idx < end; idx += block_size) {
+      dist.generate(gen, block);
+      const int count = end - idx < block_size ? end - idx : block_size;
+      for (int j = 0; j < count; ++j) a(idx + j) = block[j];
+    }
+    rand_pool.free_state(gen);
+  }
+};
+
+}  // namespace Impl
+
+/// \brief Fill a View with values drawn from a distribution.
+///
+/// Each work item draws whole blocks of values from one generator.  The
+/// View must span contiguous memory; it is filled in the order of its span.
+template <class ViewType, class RandomPool, class Distribution>
+typename std::enable_if<Impl::is_random_distribution<Distribution>::value>::type
+fill_random(ViewType a, RandomPool g, const Distribution& dist) {
+  typedef View<typename ViewType::non_const_value_type*,
+               typename ViewType::device_type, MemoryUnmanaged>
+      flat_type;
+
+  if (!a.span_is_contiguous()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::fill_random with a distribution requires a contiguous View");
+  }
+
+  const int64_t n = a.span();
+  if (n > 0)
+    parallel_for(
+        "Kokkos::fill_random", (n + 1023) / 1024,
+        Impl::fill_random_distribution_functor<flat_type, RandomPool,
+                                               Distribution, 1024>(
+            flat_type(a.data(), n), g, dist));
+}
 }  // namespace Kokkos
 
 #endif
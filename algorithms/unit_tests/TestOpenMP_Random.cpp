@@ -66,11 +66,39 @@ namespace Test {
         num_draws);                                                       \
   }
 
+#define OPENMP_RANDOM_PHILOX4X32(num_draws)                             \
+  TEST(openmp, Random_Philox4x32) {                                     \
+    Impl::test_random<Kokkos::Random_Philox4x32_Pool<Kokkos::OpenMP> >( \
+        num_draws);                                                     \
+  }
+
+#define OPENMP_RANDOM_THREEFRY4X64(num_draws)                             \
+  TEST(openmp, Random_Threefry4x64) {                                     \
+    Impl::test_random<Kokkos::Random_Threefry4x64_Pool<Kokkos::OpenMP> >( \
+        num_draws);                                                       \
+  }
+
+TEST(openmp, Random_CounterBased) {
+  Impl::test_random_counter<Kokkos::OpenMP>();
+}
+
+TEST(openmp, Random_FillDistribution) {
+  Impl::test_fill_random_distributions<Kokkos::OpenMP>();
+}
+
+TEST(openmp, Random_XorShift1024_Substreams) {
+  Impl::test_random_xorshift1024_substreams<Kokkos::OpenMP>();
+}
+
 OPENMP_RANDOM_XORSHIFT64(10240000)
 OPENMP_RANDOM_XORSHIFT1024(10130144)
+OPENMP_RANDOM_PHILOX4X32(10240000)
+OPENMP_RANDOM_THREEFRY4X64(10240000)
 
 #undef OPENMP_RANDOM_XORSHIFT64
 #undef OPENMP_RANDOM_XORSHIFT1024
+#undef OPENMP_RANDOM_PHILOX4X32
+#undef OPENMP_RANDOM_THREEFRY4X64
 }  // namespace Test
 #else
 void KOKKOS_ALGORITHMS_UNITTESTS_TESTOPENMP_PREVENT_LINK_ERROR() {}
@@ -52,6 +52,7 @@
 #include <Kokkos_Random.hpp>
 #include <cmath>
 #include <chrono>
+#include <limits>
 
 namespace Test {
 
@@ -489,6 +490,289 @@ void test_random(unsigned int num_draws) {
   ASSERT_EQ(test_double.pass_hist3d_var, 1);
   ASSERT_EQ(test_double.pass_hist3d_covar, 1);
 }
+
+// The counter-based generators must reproduce the known answers of the
+// reference implementation (Random123 kat_vectors) and must give the same
+// sequence for a stream whether drawn on the device or on the host.
+template <class ExecutionSpace>
+struct test_random_counter_functor {
+  typedef Kokkos::View<uint64_t * [6], ExecutionSpace> values_type;
+
+  values_type values;
+  uint64_t seed;
+
+  test_random_counter_functor(values_type values_, uint64_t seed_)
+      : values(values_), seed(seed_) {}
+
+  template <class Philox, class Threefry>
+  KOKKOS_INLINE_FUNCTION static void draw(Philox& philox, Threefry& threefry,
+                                          uint64_t value[6]) {
+    uint32_t block[4];
+    value[0] = philox.urand();
+    value[1] = philox.urand64();
+    philox.urand4(block);
+    value[2] = block[3];
+    value[3] = philox.urand64();
+    value[4] = threefry.urand64(1000);
+    value[5] = threefry.urand64() ^ threefry.urand64() ^ threefry.urand64();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    Kokkos::Random_Philox4x32<ExecutionSpace> philox(seed, i);
+    Kokkos::Random_Threefry4x64<ExecutionSpace> threefry(seed, i);
+    uint64_t value[6];
+    draw(philox, threefry, value);
+    for (int k = 0; k < 6; ++k) values(i, k) = value[k];
+  }
+};
+
+template <class ExecutionSpace>
+void test_random_counter() {
+  typedef Kokkos::DefaultHostExecutionSpace host_space;
+  typedef Kokkos::Random_Philox4x32<host_space> philox_type;
+  typedef Kokkos::Random_Threefry4x64<host_space> threefry_type;
+
+  {
+    const uint32_t key[3][2] = {
+        {0x00000000, 0x00000000},
+        {0xffffffff, 0xffffffff},
+        {0xa4093822, 0x299f31d0}};
+    const uint32_t ctr[3][4] = {
+        {0x00000000, 0x00000000, 0x00000000, 0x00000000},
+        {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+        {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+    const uint32_t known[3][4] = {
+        {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+        {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+        {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+    for (int i = 0; i < 3; ++i) {
+      uint32_t out[4];
+      philox_type::bijection(key[i], ctr[i], out);
+      for (int j = 0; j < 4; ++j) ASSERT_EQ(out[j], known[i][j]);
+    }
+  }
+
+  {
+    const uint64_t zero[4]     = {0, 0, 0, 0};
+    const uint64_t ones[4]     = {~uint64_t(0), ~uint64_t(0), ~uint64_t(0),
+                                  ~uint64_t(0)};
+    const uint64_t known[2][4] = {
+        {0x09218ebde6c85537ULL, 0x55941f5266d86105ULL, 0x4bd25e16282434dcULL,
+         0xee29ec846bd2e40bULL},
+        {0x29c24097942bba1bULL, 0x0371bbfb0f6f4e11ULL, 0x3c231ffa33f83a1cULL,
+         0xcd29113fde32d168ULL}};
+    uint64_t out[4];
+    threefry_type::bijection(zero, zero, out);
+    for (int j = 0; j < 4; ++j) ASSERT_EQ(out[j], known[0][j]);
+    threefry_type::bijection(ones, ones, out);
+    for (int j = 0; j < 4; ++j) ASSERT_EQ(out[j], known[1][j]);
+  }
+
+  const int n         = 10000;
+  const uint64_t seed = 5374857;
+
+  typedef test_random_counter_functor<ExecutionSpace> functor_type;
+  typename functor_type::values_type values("Values", n);
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, n),
+                       functor_type(values, seed));
+  auto h_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+
+  for (int i = 0; i < n; ++i) {
+    philox_type philox(seed, i);
+    threefry_type threefry(seed, i);
+    uint64_t value[6];
+    functor_type::draw(philox, threefry, value);
+    for (int k = 0; k < 6; ++k) ASSERT_EQ(h_values(i, k), value[k]);
+  }
+
+  // Blocks of a stream are addressable by counter
+  philox_type philox(seed, 7);
+  uint32_t block[4];
+  for (int i = 0; i < 3; ++i) philox.urand4(block);
+  ASSERT_EQ(philox.counter(), uint64_t(3));
+  philox_type philox_skip(seed, 7, 2);
+  uint32_t block_skip[4];
+  philox_skip.urand4(block_skip);
+  for (int j = 0; j < 4; ++j) ASSERT_EQ(block[j], block_skip[j]);
+
+  // Floating point blocks are in [0,1)
+  for (int i = 0; i < 1000; ++i) {
+    float f[4];
+    double d[4];
+    philox.frand4(f);
+    threefry_type(seed, i).drand4(d);
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_TRUE(0.0f <= f[j] && f[j] < 1.0f);
+      ASSERT_TRUE(0.0 <= d[j] && d[j] < 1.0);
+    }
+  }
+}
+
+// Moments of bulk-filled distributions against their analytical values.
+template <class ExecutionSpace, class Distribution>
+void test_fill_random_distribution(const Distribution& dist,
+                                   const double mean, const double variance,
+                                   const double lower, const double upper) {
+  typedef typename Distribution::value_type value_type;
+
+  const int n = 1 << 20;
+  Kokkos::View<value_type**, ExecutionSpace> values("Values", n / 64, 64);
+  Kokkos::Random_Philox4x32_Pool<ExecutionSpace> pool(31891);
+  Kokkos::fill_random(values, pool, dist);
+  auto h_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+
+  double sum = 0;
+  for (int i = 0; i < n / 64; ++i) {
+    for (int j = 0; j < 64; ++j) {
+      ASSERT_LE(lower, h_values(i, j));
+      ASSERT_GE(upper, h_values(i, j));
+      sum += h_values(i, j);
+    }
+  }
+  const double sample_mean = sum / n;
+  double sum2              = 0;
+  for (int i = 0; i < n / 64; ++i) {
+    for (int j = 0; j < 64; ++j) {
+      const double d = h_values(i, j) - sample_mean;
+      sum2 += d * d;
+    }
+  }
+  const double sample_variance = sum2 / (n - 1);
+
+  // Five standard errors of the mean, two percent of the variance
+  ASSERT_NEAR(sample_mean, mean, 5 * std::sqrt(variance / n));
+  ASSERT_NEAR(sample_variance, variance, 0.02 * variance);
+}
+
+inline double normal_pdf(const double x) {
+  return std::isinf(x) ? 0.0 : std::exp(-0.5 * x * x) / std::sqrt(2 * M_PI);
+}
+
+inline double normal_cdf(const double x) {
+  return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+template <class ExecutionSpace>
+void test_fill_random_distributions() {
+  const double inf = std::numeric_limits<double>::infinity();
+
+  test_fill_random_distribution<ExecutionSpace>(
+      Kokkos::normal_distribution<double>(2.0, 3.0), 2.0, 9.0, -inf, inf);
+  test_fill_random_distribution<ExecutionSpace>(
+      Kokkos::exponential_distribution<double>(2.0), 0.5, 0.25, 0, inf);
+  test_fill_random_distribution<ExecutionSpace>(
+      Kokkos::gamma_distribution<double>(2.5, 2.0), 5.0, 10.0, 0, inf);
+  test_fill_random_distribution<ExecutionSpace>(
+      Kokkos::gamma_distribution<double>(0.5, 1.0), 0.5, 0.5, 0, inf);
+  test_fill_random_distribution<ExecutionSpace>(
+      Kokkos::poisson_distribution<int64_t>(4.0), 4.0, 4.0, 0, inf);
+  test_fill_random_distribution<ExecutionSpace>(
+      Kokkos::poisson_distribution<int64_t>(50.0), 50.0, 50.0, 0, inf);
+
+  // Truncated standard normal, the moments on [a,b] follow from
+  //   mean     = (phi(a) - phi(b)) / Z
+  //   variance = 1 + (a phi(a) - b phi(b)) / Z - mean^2
+  // with Z = Phi(b) - Phi(a).
+  const double bounds[4][2] = {{-1, 2}, {-0.5, 0.5}, {3, inf}, {-inf, -2.5}};
+  for (int i = 0; i < 4; ++i) {
+    const double a    = bounds[i][0];
+    const double b    = bounds[i][1];
+    const double z    = normal_cdf(b) - normal_cdf(a);
+    const double mean = (normal_pdf(a) - normal_pdf(b)) / z;
+    const double ta   = std::isinf(a) ? 0.0 : a * normal_pdf(a);
+    const double tb   = std::isinf(b) ? 0.0 : b * normal_pdf(b);
+    const double var  = 1 + (ta - tb) / z - mean * mean;
+    test_fill_random_distribution<ExecutionSpace>(
+        Kokkos::truncated_normal_distribution<double>(0.0, 1.0, a, b), mean,
+        var, a, b);
+  }
+}
+
+// Draw from the states of a pool, and from each state after a jump.
+// The generators are not freed so both draws begin from the pool's state.
+template <class Pool>
+struct test_random_substream_functor {
+  typedef typename Pool::device_type::execution_space execution_space;
+  typedef Kokkos::View<uint64_t * [2], execution_space> values_type;
+
+  Pool pool;
+  values_type values;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    typename Pool::generator_type jumped = pool.get_state(i);
+    jumped.jump();
+    values(i, 1) = jumped.urand64();
+
+    typename Pool::generator_type gen = pool.get_state(i);
+    values(i, 0)                      = gen.urand64();
+  }
+};
+
+template <class ExecutionSpace>
+void test_random_xorshift1024_substreams() {
+  typedef Kokkos::Random_XorShift1024_Pool<ExecutionSpace> pool_type;
+  typedef test_random_substream_functor<pool_type> functor_type;
+
+  // Jump ahead by a polynomial without reduction is plain stepping
+  {
+    uint64_t state[16], jumped[16];
+    for (int j = 0; j < 16; ++j) {
+      state[j] = jumped[j] = Kokkos::Impl::random_splitmix64(17, j);
+    }
+    int p = 3, p_jumped = 3;
+    uint64_t poly[16] = {0};
+    poly[700 / 64]    = uint64_t(1) << (700 % 64);
+    for (int i = 0; i < 700; ++i) {
+      Kokkos::Impl::random_xorshift1024_next(state, p);
+    }
+    Kokkos::Impl::random_xorshift1024_jump(jumped, p_jumped, poly);
+    for (int j = 0; j < 16; ++j) {
+      ASSERT_EQ(state[(j + p) & 15], jumped[(j + p_jumped) & 15]);
+    }
+
+    // A squared jump polynomial jumps twice as far
+    Kokkos::Impl::Random_XorShift1024_Jump jump;
+    Kokkos::Impl::random_xorshift1024_jump(state, p, jump.poly);
+    Kokkos::Impl::random_xorshift1024_jump(state, p, jump.poly);
+    jump.square();
+    Kokkos::Impl::random_xorshift1024_jump(jumped, p_jumped, jump.poly);
+    for (int j = 0; j < 16; ++j) {
+      ASSERT_EQ(state[(j + p) & 15], jumped[(j + p_jumped) & 15]);
+    }
+  }
+
+  const int n = 37;
+  pool_type pool;
+  pool.init_substreams(9753, n);
+  typename functor_type::values_type values("Values", n);
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, n),
+                       functor_type{pool, values});
+
+  pool_type offset_pool;
+  offset_pool.init_substreams(9753, n - 21, 21);
+  typename functor_type::values_type offset_values("OffsetValues", n - 21);
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, n - 21),
+                       functor_type{offset_pool, offset_values});
+
+  auto h_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+  auto h_offset_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), offset_values);
+
+  for (int i = 0; i + 1 < n; ++i) {
+    // State i + 1 begins where state i jumps to
+    ASSERT_EQ(h_values(i, 1), h_values(i + 1, 0));
+    ASSERT_NE(h_values(i, 0), h_values(i + 1, 0));
+  }
+  for (int i = 0; i < n - 21; ++i) {
+    ASSERT_EQ(h_values(i + 21, 0), h_offset_values(i, 0));
+  }
+}
+
 }  // namespace Impl
 
 }  // namespace Test
@@ -69,6 +69,30 @@ namespace Test {
         num_draws);                                                       \
   }
 
+#define SERIAL_RANDOM_PHILOX4X32(num_draws)                             \
+  TEST(serial, Random_Philox4x32) {                                     \
+    Impl::test_random<Kokkos::Random_Philox4x32_Pool<Kokkos::Serial> >( \
+        num_draws);                                                     \
+  }
+
+#define SERIAL_RANDOM_THREEFRY4X64(num_draws)                             \
+  TEST(serial, Random_Threefry4x64) {                                     \
+    Impl::test_random<Kokkos::Random_Threefry4x64_Pool<Kokkos::Serial> >( \
+        num_draws);                                                       \
+  }
+
+TEST(serial, Random_CounterBased) {
+  Impl::test_random_counter<Kokkos::Serial>();
+}
+
+TEST(serial, Random_FillDistribution) {
+  Impl::test_fill_random_distributions<Kokkos::Serial>();
+}
+
+TEST(serial, Random_XorShift1024_Substreams) {
+  Impl::test_random_xorshift1024_substreams<Kokkos::Serial>();
+}
+
 #define SERIAL_SORT_UNSIGNED(size)                   \
   TEST(serial, SortUnsigned) {                       \
     Impl::test_sort<Kokkos::Serial, unsigned>(size); \
@@ -76,10 +100,14 @@ namespace Test {
 
 SERIAL_RANDOM_XORSHIFT64(10240000)
 SERIAL_RANDOM_XORSHIFT1024(10130144)
+SERIAL_RANDOM_PHILOX4X32(10240000)
+SERIAL_RANDOM_THREEFRY4X64(10240000)
 SERIAL_SORT_UNSIGNED(171)
 
 #undef SERIAL_RANDOM_XORSHIFT64
 #undef SERIAL_RANDOM_XORSHIFT1024
+#undef SERIAL_RANDOM_PHILOX4X32
+#undef SERIAL_RANDOM_THREEFRY4X64
 #undef SERIAL_SORT_UNSIGNED
 
 }  // namespace Test
@@ -69,6 +69,30 @@ namespace Test {
         num_draws);                                                        \
   }
 
+#define THREADS_RANDOM_PHILOX4X32(num_draws)                             \
+  TEST(threads, Random_Philox4x32) {                                     \
+    Impl::test_random<Kokkos::Random_Philox4x32_Pool<Kokkos::Threads> >( \
+        num_draws);                                                      \
+  }
+
+#define THREADS_RANDOM_THREEFRY4X64(num_draws)                             \
+  TEST(threads, Random_Threefry4x64) {                                     \
+    Impl::test_random<Kokkos::Random_Threefry4x64_Pool<Kokkos::Threads> >( \
+        num_draws);                                                        \
+  }
+
+TEST(threads, Random_CounterBased) {
+  Impl::test_random_counter<Kokkos::Threads>();
+}
+
+TEST(threads, Random_FillDistribution) {
+  Impl::test_fill_random_distributions<Kokkos::Threads>();
+}
+
+TEST(threads, Random_XorShift1024_Substreams) {
+  Impl::test_random_xorshift1024_substreams<Kokkos::Threads>();
+}
+
 #define THREADS_SORT_UNSIGNED(size)                 \
   TEST(threads, SortUnsigned) {                     \
     Impl::test_sort<Kokkos::Threads, double>(size); \
@@ -76,10 +100,14 @@ namespace Test {
 
 THREADS_RANDOM_XORSHIFT64(10240000)
 THREADS_RANDOM_XORSHIFT1024(10130144)
+THREADS_RANDOM_PHILOX4X32(10240000)
+THREADS_RANDOM_THREEFRY4X64(10240000)
 THREADS_SORT_UNSIGNED(171)
 
 #undef THREADS_RANDOM_XORSHIFT64
 #undef THREADS_RANDOM_XORSHIFT1024
+#undef THREADS_RANDOM_PHILOX4X32
+#undef THREADS_RANDOM_THREEFRY4X64
 #undef THREADS_SORT_UNSIGNED
 
 }  // namespace Test
@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <impl/Kokkos_Timer.hpp>
+#include <cstdio>
+#include <cstdlib>
+
+// Per-element draws through generator::normal(), the Marsaglia polar method
+template <class Pool>
+struct normal_polar {
+  Kokkos::View<double*> a;
+  Pool pool;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i) const {
+    typename Pool::generator_type gen = pool.get_state();
+    a(i)                              = gen.normal();
+    pool.free_state(gen);
+  }
+};
+
+template <class Fill>
+double run(const char* name, const int64_t N, const int R, const Fill& fill) {
+  fill();  // warm up
+  Kokkos::fence();
+
+  Kokkos::Impl::Timer timer;
+  for (int r = 0; r < R; ++r) fill();
+  Kokkos::fence();
+  const double time = timer.seconds() / R;
+
+  printf("%-36s %12.4e s %10.3f Gvalues/s\n", name, time, 1.0e-9 * N / time);
+  return time;
+}
+
+int main(int argc, char* argv[]) {
+  Kokkos::initialize(argc, argv);
+  {
+    if (argc < 3) {
+      printf("Arguments: N R\n");
+      printf("  N:   Number of values to generate\n");
+      printf("  R:   Number of repeats of the experiments\n");
+      printf("Example Input:\n");
+      printf("  100000000 10\n");
+      Kokkos::finalize();
+      return 0;
+    }
+
+    const int64_t N = atol(argv[1]);
+    const int R     = atoi(argv[2]);
+
+    typedef Kokkos::Random_XorShift64_Pool<> xorshift_pool;
+    typedef Kokkos::Random_Philox4x32_Pool<> philox_pool;
+    typedef Kokkos::Random_Threefry4x64_Pool<> threefry_pool;
+
+    Kokkos::View<double*> a("A", N);
+    Kokkos::View<int64_t*> k("K", N);
+    xorshift_pool xorshift(5374857);
+    philox_pool philox(5374857);
+    threefry_pool threefry(5374857);
+
+    run("uniform XorShift64", N, R,
+        [&]() { Kokkos::fill_random(a, xorshift, 1.0); });
+    run("uniform Philox4x32", N, R,
+        [&]() { Kokkos::fill_random(a, philox, 1.0); });
+    run("uniform Threefry4x64", N, R,
+        [&]() { Kokkos::fill_random(a, threefry, 1.0); });
+
+    run("normal polar per element XorShift64", N, R, [&]() {
+      Kokkos::parallel_for(N, normal_polar<xorshift_pool>{a, xorshift});
+    });
+    run("normal Box-Muller XorShift64", N, R, [&]() {
+      Kokkos::fill_random(a, xorshift, Kokkos::normal_distribution<>());
+    });
+    run("normal Box-Muller Philox4x32", N, R, [&]() {
+      Kokkos::fill_random(a, philox, Kokkos::normal_distribution<>());
+    });
+    run("exponential Philox4x32", N, R, [&]() {
+      Kokkos::fill_random(a, philox, Kokkos::exponential_distribution<>());
+    });
+    run("gamma(2.5) Philox4x32", N, R, [&]() {
+      Kokkos::fill_random(a, philox, Kokkos::gamma_distribution<>(2.5));
+    });
+    run("poisson(4) Philox4x32", N, R, [&]() {
+      Kokkos::fill_random(k, philox, Kokkos::poisson_distribution<>(4.0));
+    });
+    run("poisson(100) Philox4x32", N, R, [&]() {
+      Kokkos::fill_random(k, philox, Kokkos::poisson_distribution<>(100.0));
+    });
+    run("truncated normal [0,1] Philox4x32", N, R, [&]() {
+      Kokkos::fill_random(
+          a, philox,
+          Kokkos::truncated_normal_distribution<>(0.0, 1.0, 0.0, 1.0));
+    });
+  }
+  Kokkos::finalize();
+  return 0;
+}
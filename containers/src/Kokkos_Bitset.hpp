@@ -130,6 +130,34 @@ class Bitset {
     return f.apply();
   }
 
+  /// write the indices of the bits which are set to 1 into indices
+  /// in increasing order and return the number of bits which are set;
+  /// indices which do not fit in indices.extent(0) are dropped
+  /// can only be called from the host
+  template <class IndexView>
+  unsigned find_all_set(IndexView const& indices) const {
+    Impl::BitsetCompact<Bitset<Device>, IndexView> f(*this, indices);
+    return f.apply();
+  }
+
+  /// bitwise and with rhs, returns the number of bits which are set to 1
+  /// can only be called from the host
+  unsigned bitwise_and(ConstBitset<Device> const& rhs) {
+    return assign<Impl::BitsetAnd>(rhs);
+  }
+
+  /// bitwise or with rhs, returns the number of bits which are set to 1
+  /// can only be called from the host
+  unsigned bitwise_or(ConstBitset<Device> const& rhs) {
+    return assign<Impl::BitsetOr>(rhs);
+  }
+
+  /// bitwise xor with rhs, returns the number of bits which are set to 1
+  /// can only be called from the host
+  unsigned bitwise_xor(ConstBitset<Device> const& rhs) {
+    return assign<Impl::BitsetXor>(rhs);
+  }
+
   /// set all bits to 1
   /// can only be called from the host
   void set() {
@@ -276,6 +304,16 @@ class Bitset {
     return static_cast<unsigned>(block_idx) * block_size + offset;
   }
 
+  template <class Op>
+  unsigned assign(ConstBitset<Device> const& rhs) {
+    if (m_size != rhs.size()) {
+      throw std::runtime_error(
+          "Error: Cannot combine bitsets of different sizes!");
+    }
+    Impl::BitsetAssign<Bitset<Device>, ConstBitset<Device>, Op> f(*this, rhs);
+    return f.apply();
+  }
+
  private:
   unsigned m_size;
   unsigned m_last_block_mask;
@@ -291,6 +329,12 @@ class Bitset {
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
+  template <typename Bitset, typename IndexView>
+  friend struct Impl::BitsetCompact;
+
+  template <typename DstBitset, typename SrcBitset, typename Op>
+  friend struct Impl::BitsetAssign;
+
   template <typename DstDevice, typename SrcDevice>
   friend void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src);
 
@@ -343,6 +387,12 @@ class ConstBitset {
     return f.apply();
   }
 
+  template <class IndexView>
+  unsigned find_all_set(IndexView const& indices) const {
+    Impl::BitsetCompact<ConstBitset<Device>, IndexView> f(*this, indices);
+    return f.apply();
+  }
+
   KOKKOS_FORCEINLINE_FUNCTION
   bool test(unsigned i) const {
     if (i < m_size) {
@@ -364,6 +414,12 @@ class ConstBitset {
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
+  template <typename Bitset, typename IndexView>
+  friend struct Impl::BitsetCompact;
+
+  template <typename DstBitset, typename SrcBitset, typename Op>
+  friend struct Impl::BitsetAssign;
+
   template <typename DstDevice, typename SrcDevice>
   friend void deep_copy(Bitset<DstDevice>& dst,
                         ConstBitset<SrcDevice> const& src);
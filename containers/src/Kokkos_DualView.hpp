@@ -55,6 +55,72 @@
 #include <impl/Kokkos_Error.hpp>
 
 namespace Kokkos {
+namespace Impl {
+
+/* Rows [begin, end) of the leading dimension of a DualView modified on
+ * one side since the last sync, kept sorted and disjoint.  Past
+ * max_ranges the two ranges separated by the smallest gap are joined.
+ */
+struct DualViewDirtyRanges {
+  enum : size_t { max_ranges = 8, all = ~size_t(0) };
+
+  size_t count;  // number of ranges, or 'all' if every row is modified
+  size_t begin[max_ranges + 1];
+  size_t end[max_ranges + 1];
+
+  void clear() { count = 0; }
+
+  void mark_all() { count = all; }
+
+  void add(const size_t b, const size_t e) {
+    if (count == all || b == e) return;
+
+    size_t i = count++;
+    for (; 0 < i && b < begin[i - 1]; --i) {
+      begin[i] = begin[i - 1];
+      end[i]   = end[i - 1];
+    }
+    begin[i] = b;
+    end[i]   = e;
+
+    // Coalesce overlapping or adjacent ranges
+    size_t n = 0;
+    for (size_t k = 1; k < count; ++k) {
+      if (begin[k] <= end[n]) {
+        if (end[n] < end[k]) end[n] = end[k];
+      } else {
+        ++n;
+        begin[n] = begin[k];
+        end[n]   = end[k];
+      }
+    }
+    count = n + 1;
+
+    if (max_ranges < count) {
+      size_t k = 0;
+      for (size_t m = 1; m + 1 < count; ++m) {
+        if (begin[m + 1] - end[m] < begin[k + 1] - end[k]) k = m;
+      }
+      end[k] = end[k + 1];
+      for (++k; k + 1 < count; ++k) {
+        begin[k] = begin[k + 1];
+        end[k]   = end[k + 1];
+      }
+      --count;
+    }
+  }
+
+  // Copying the ranges only pays off while they cover at most half
+  // of the 'rows', otherwise one bulk copy is cheaper.
+  bool use_ranges(const size_t rows) const {
+    if (count == all) return false;
+    size_t n = 0;
+    for (size_t i = 0; i < count; ++i) n += end[i] - begin[i];
+    return 2 * n <= rows;
+  }
+};
+
+}  // namespace Impl
 
 /* \class DualView
  * \brief Container to manage mirroring a Kokkos::View that lives
@@ -70,6 +136,11 @@ namespace Kokkos {
  * templated on the device towards which they want to synchronize
  * (i.e., the target of the one-way copy operation).
  *
+ * The modify() functions optionally take a range of rows of the leading
+ * dimension.  If only ranged modifications were marked since the last
+ * sync, and the rows are contiguous in memory (rank one or LayoutRight),
+ * sync() copies only the modified rows.
+ *
  * The DualView class also provides convenience methods such as
  * realloc, resize and capacity which call the appropriate methods of
  * the underlying Kokkos::View objects.
@@ -192,6 +263,14 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   t_modified_flag modified_host, modified_device;
 #endif
 
+ private:
+  typedef View<Impl::DualViewDirtyRanges, Kokkos::HostSpace> t_dirty_ranges;
+  t_dirty_ranges dirty_ranges;
+  // Subviews share the ranges of the DualView they were taken from,
+  // which are not in their index space, so they only invalidate them.
+  bool dirty_ranges_apply = true;
+
+ public:
   //@}
   //! \name Constructors
   //@{
@@ -231,7 +310,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       : d_view(label, n0, n1, n2, n3, n4, n5, n6, n7),
         h_view(create_mirror_view(d_view))  // without UVM, host View mirrors
         ,
-        modified_flags(t_modified_flags("DualView::modified_flags")) {
+        modified_flags(t_modified_flags("DualView::modified_flags")),
+        dirty_ranges(t_dirty_ranges("DualView::dirty_ranges")) {
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
     modified_host   = t_modified_flag(modified_flags, 0);
     modified_device = t_modified_flag(modified_flags, 1);
@@ -263,7 +343,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       : d_view(arg_prop, n0, n1, n2, n3, n4, n5, n6, n7),
         h_view(create_mirror_view(d_view))  // without UVM, host View mirrors
         ,
-        modified_flags(t_modified_flags("DualView::modified_flags")) {
+        modified_flags(t_modified_flags("DualView::modified_flags")),
+        dirty_ranges(t_dirty_ranges("DualView::dirty_ranges")) {
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
     modified_host   = t_modified_flag(modified_flags, 0);
     modified_device = t_modified_flag(modified_flags, 1);
@@ -290,7 +371,9 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   DualView(const DualView<SS, LS, DS, MS>& src)
       : d_view(src.d_view),
         h_view(src.h_view),
-        modified_flags(src.modified_flags)
+        modified_flags(src.modified_flags),
+        dirty_ranges(src.dirty_ranges),
+        dirty_ranges_apply(src.dirty_ranges_apply)
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
         ,
         modified_host(src.modified_host),
@@ -304,7 +387,9 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   DualView(const DualView<SD, S1, S2, S3>& src, const Arg0& arg0, Args... args)
       : d_view(Kokkos::subview(src.d_view, arg0, args...)),
         h_view(Kokkos::subview(src.h_view, arg0, args...)),
-        modified_flags(src.modified_flags)
+        modified_flags(src.modified_flags),
+        dirty_ranges(src.dirty_ranges),
+        dirty_ranges_apply(false)
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
         ,
         modified_host(src.modified_host),
@@ -326,7 +411,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   DualView(const t_dev& d_view_, const t_host& h_view_)
       : d_view(d_view_),
         h_view(h_view_),
-        modified_flags(t_modified_flags("DualView::modified_flags")) {
+        modified_flags(t_modified_flags("DualView::modified_flags")),
+        dirty_ranges(t_dirty_ranges("DualView::dirty_ranges")) {
     if (int(d_view.rank) != int(h_view.rank) ||
         d_view.extent(0) != h_view.extent(0) ||
         d_view.extent(1) != h_view.extent(1) ||
@@ -538,7 +624,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
         }
 #endif
 
-        deep_copy(d_view, h_view);
+        impl_copy_modified(d_view, h_view);
         modified_flags(0) = modified_flags(1) = 0;
       }
     }
@@ -554,7 +640,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
         }
 #endif
 
-        deep_copy(h_view, d_view);
+        impl_copy_modified(h_view, d_view);
         modified_flags(0) = modified_flags(1) = 0;
       }
     }
@@ -606,7 +692,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       }
 #endif
 
-      deep_copy(h_view, d_view);
+      impl_copy_modified(h_view, d_view);
       modified_flags(1) = modified_flags(0) = 0;
     }
   }
@@ -628,7 +714,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       }
 #endif
 
-      deep_copy(d_view, h_view);
+      impl_copy_modified(d_view, h_view);
       modified_flags(1) = modified_flags(0) = 0;
     }
   }
@@ -671,6 +757,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
     if (modified_flags.data() == nullptr) return;
     int dev = get_device_side<Device>();
 
+    if (dirty_ranges.data() != nullptr) dirty_ranges().mark_all();
+
     if (dev == 1) {  // if Device is the same as DualView's device type
       // Increment the device's modified count.
       modified_flags(1) =
@@ -700,6 +788,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
 
   inline void modify_host() {
     if (modified_flags.data() != nullptr) {
+      if (dirty_ranges.data() != nullptr) dirty_ranges().mark_all();
       modified_flags(0) =
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
@@ -719,6 +808,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
 
   inline void modify_device() {
     if (modified_flags.data() != nullptr) {
+      if (dirty_ranges.data() != nullptr) dirty_ranges().mark_all();
       modified_flags(1) =
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
@@ -736,11 +826,103 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
     }
   }
 
+  /// \brief Mark only the rows [range.first, range.second) of the
+  ///   leading dimension as modified on the given device \c Device.
+  ///
+  /// Successive ranged modifications of the same side accumulate, and
+  /// the next sync copies only those rows.  Any modification without a
+  /// range, or of the other side, falls back to copying everything.
+  template <class Device>
+  void modify(const Kokkos::pair<size_t, size_t>& range) {
+    const int dev = get_device_side<Device>();
+    if (dev == 0 || dev == 1) impl_modify_range(dev, range);
+  }
+
+  inline void modify_host(const Kokkos::pair<size_t, size_t>& range) {
+    impl_modify_range(0, range);
+  }
+
+  inline void modify_device(const Kokkos::pair<size_t, size_t>& range) {
+    impl_modify_range(1, range);
+  }
+
   inline void clear_sync_state() {
     if (modified_flags.data() != nullptr)
       modified_flags(1) = modified_flags(0) = 0;
+    if (dirty_ranges.data() != nullptr) dirty_ranges().clear();
   }
 
+ private:
+  void impl_modify_range(const int side,
+                         const Kokkos::pair<size_t, size_t>& range) {
+    if (range.second < range.first || d_view.extent(0) < range.second) {
+      Impl::throw_runtime_exception(
+          "Kokkos::DualView::modify range exceeds extent(0)");
+    }
+    if (modified_flags.data() == nullptr) return;
+
+    const bool track = dirty_ranges.data() != nullptr && dirty_ranges_apply;
+
+    // The rows must be decided before the flags are updated
+    Impl::DualViewDirtyRanges ranges;
+    if (track) {
+      if (modified_flags(0) == modified_flags(1)) {
+        ranges.clear();
+      } else if (modified_flags(side) > modified_flags(1 - side)) {
+        ranges = dirty_ranges();
+      } else {
+        ranges.mark_all();
+      }
+      ranges.add(range.first, range.second);
+    }
+
+    if (side == 0) {
+      modify_host();
+    } else {
+      modify_device();
+    }
+
+    if (track) dirty_ranges() = ranges;
+  }
+
+  // Copy the modified rows of 'src' into 'dst', all of them unless only
+  // a few contiguous ranges are known to be modified.
+  template <class DstView, class SrcView>
+  void impl_copy_modified(const DstView& dst, const SrcView& src) {
+    const bool ranged =
+        dirty_ranges.data() != nullptr && dirty_ranges_apply &&
+        (1 == unsigned(DstView::rank) ||
+         std::is_same<typename traits::array_layout, LayoutRight>::value) &&
+        dst.span_is_contiguous() && src.span_is_contiguous() &&
+        dst.stride_0() == src.stride_0() &&
+        dirty_ranges().use_ranges(dst.extent(0));
+
+    if (ranged) {
+      typedef View<typename DstView::value_type*,
+                   typename DstView::memory_space, MemoryUnmanaged>
+          dst_rows_type;
+      typedef View<typename SrcView::const_value_type*,
+                   typename SrcView::memory_space, MemoryUnmanaged>
+          src_rows_type;
+
+      const Impl::DualViewDirtyRanges& ranges = dirty_ranges();
+      const size_t stride                     = dst.stride_0();
+
+      for (size_t i = 0; i < ranges.count; ++i) {
+        const size_t offset = ranges.begin[i] * stride;
+        const size_t n      = (ranges.end[i] - ranges.begin[i]) * stride;
+        deep_copy(dst_rows_type(dst.data() + offset, n),
+                  src_rows_type(src.data() + offset, n));
+      }
+    } else {
+      deep_copy(dst, src);
+    }
+
+    if (dirty_ranges.data() != nullptr) dirty_ranges().clear();
+  }
+
+ public:
+
   //@}
   //! \name Methods for reallocating or resizing the View objects.
   //@{
@@ -766,6 +948,11 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       modified_flags = t_modified_flags("DualView::modified_flags");
     } else
       modified_flags(1) = modified_flags(0) = 0;
+
+    if (dirty_ranges.data() == nullptr) {
+      dirty_ranges = t_dirty_ranges("DualView::dirty_ranges");
+    } else
+      dirty_ranges().clear();
   }
 
   /// \brief Resize both views, copying old contents into new if necessary.
@@ -783,6 +970,10 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
     if (modified_flags.data() == nullptr) {
       modified_flags = t_modified_flags("DualView::modified_flags");
     }
+    if (dirty_ranges.data() == nullptr) {
+      dirty_ranges = t_dirty_ranges("DualView::dirty_ranges");
+    } else
+      dirty_ranges().mark_all();
     if (modified_flags(1) >= modified_flags(0)) {
       /* Resize on Device */
       ::Kokkos::resize(d_view, n0, n1, n2, n3, n4, n5, n6, n7);
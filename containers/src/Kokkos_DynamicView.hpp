@@ -76,10 +76,15 @@ struct ChunkArraySpace<Kokkos::Experimental::HIPSpace> {
   using memory_space = typename Kokkos::Experimental::HIPHostPinnedSpace;
 };
 #endif
+
+template <class DstType, class SrcType>
+struct DynamicViewCompact;
 }  // end namespace Impl
 
 /** \brief Dynamic views are restricted to rank-one and no layout.
- *         Resize only occurs on host outside of parallel_regions.
+ *         Resize with resize_serial only occurs on host outside of
+ *         parallel_regions.  Concurrent growth inside parallel regions
+ *         uses grow_by or push_back.
  *         Subviews are not allowed.
  */
 template <typename DataType, typename... P>
@@ -91,6 +96,9 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
   template <class, class...>
   friend class DynamicView;
 
+  template <class, class>
+  friend struct Impl::DynamicViewCompact;
+
   typedef Kokkos::Impl::SharedAllocationTracker track_type;
 
   static_assert(traits::rank == 1 && traits::rank_dynamic == 1,
@@ -126,6 +134,64 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
                          // to a chunk of extent == m_chunk_size entries
   unsigned m_chunk_size;  // 2 << (m_chunk_shift - 1)
 
+ public:
+  /** \brief  Optional source of chunks, allows concurrent growth
+   *          inside parallel regions on any execution space.
+   */
+  typedef Kokkos::MemoryPool<typename traits::device_type> memory_pool;
+
+  enum : size_t { invalid_index = ~static_cast<size_t>(0) };
+
+ private:
+  memory_pool m_pool;
+
+  template <class Pool>
+  static memory_pool compatible_pool(const Pool&) {
+    return memory_pool();
+  }
+
+  static const memory_pool& compatible_pool(const memory_pool& pool) {
+    return pool;
+  }
+
+  // Chunks come from the memory pool if there is one,
+  // otherwise from the memory space which requires the host.
+  KOKKOS_INLINE_FUNCTION
+  static typename traits::value_type* allocate_chunk(const memory_pool& pool,
+                                                     const size_t bytes) {
+    typedef typename traits::value_type* value_pointer_type;
+    if (0 < pool.capacity()) {
+      return reinterpret_cast<value_pointer_type>(pool.allocate(bytes));
+    }
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    return reinterpret_cast<value_pointer_type>(
+        typename traits::memory_space().allocate(bytes));
+#else
+    Kokkos::abort(
+        "Kokkos::DynamicView ERROR: growth outside of the host requires a "
+        "memory pool");
+    return nullptr;
+#endif
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void deallocate_chunk(const memory_pool& pool,
+                               typename traits::value_type* const chunk,
+                               const size_t bytes) {
+    if (0 < pool.capacity()) {
+      pool.deallocate(chunk, bytes);
+    } else {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+      typename traits::memory_space().deallocate(chunk, bytes);
+#endif
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t chunk_bytes() const noexcept {
+    return sizeof(typename traits::value_type) << m_chunk_shift;
+  }
+
  public:
   //----------------------------------------------------------------------
 
@@ -287,6 +353,77 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     return (*ch)[i0 & m_chunk_mask];
   }
 
+  //----------------------------------------
+  /** \brief  Concurrently append 'n' entries, callable within parallel
+   *          regions.  Returns the index of the first appended entry or
+   *          'invalid_index' if the maximum extent would be exceeded.
+   *
+   *  The entries are reserved by atomically advancing the extent and
+   *  missing chunks are installed lock-free; when two threads race to
+   *  install the same chunk the loser returns its chunk.  Entries
+   *  appended by other threads may be accessed only after the
+   *  parallel region completes.
+   */
+  template <typename IntType>
+  KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<std::is_integral<IntType>::value, size_t>::type
+      grow_by(IntType const& n) const {
+    typedef typename traits::value_type* value_pointer_type;
+
+    DynamicView::template verify_space<
+        Kokkos::Impl::ActiveExecutionMemorySpace>::check();
+
+    // *m_chunks[m_chunk_max+1] stores the extent
+    size_t* const pe = reinterpret_cast<size_t*>(m_chunks + m_chunk_max + 1);
+
+    const size_t capacity = size_t(m_chunk_max) << m_chunk_shift;
+    const size_t count    = size_t(n);
+
+    size_t begin = *reinterpret_cast<size_t volatile*>(pe);
+
+    for (;;) {
+      if (capacity < begin || capacity - begin < count) return invalid_index;
+      const size_t old = Kokkos::atomic_compare_exchange(pe, begin,
+                                                         begin + count);
+      if (old == begin) break;
+      begin = old;
+    }
+
+    const uintptr_t chunk_end = (begin + count + m_chunk_mask) >> m_chunk_shift;
+
+    for (uintptr_t ic = begin >> m_chunk_shift; ic < chunk_end; ++ic) {
+      if (nullptr == *(m_chunks + ic)) {
+        value_pointer_type const chunk = allocate_chunk(m_pool, chunk_bytes());
+
+        if (nullptr == chunk) {
+          Kokkos::abort("Kokkos::DynamicView::grow_by out of memory");
+        }
+
+        const value_pointer_type nil = nullptr;
+
+        if (nil != Kokkos::atomic_compare_exchange(m_chunks + ic, nil, chunk)) {
+          deallocate_chunk(m_pool, chunk, chunk_bytes());
+        }
+      }
+    }
+
+    // *m_chunks[m_chunk_max] stores the number of chunks in use
+    Kokkos::atomic_fetch_max(
+        reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max), chunk_end);
+
+    return begin;
+  }
+
+  /** \brief  Concurrently append one entry, callable within parallel
+   *          regions.  Returns its index or 'invalid_index'.
+   */
+  KOKKOS_INLINE_FUNCTION
+  size_t push_back(const typename traits::value_type& value) const {
+    const size_t i = grow_by(1);
+    if (invalid_index != i) (*this)(i) = value;
+    return i;
+  }
+
   //----------------------------------------
   /** \brief  Resizing in serial can grow or shrink the array size
    *          up to the maximum number of chunks
@@ -299,9 +436,6 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
           typename Impl::ChunkArraySpace<
               typename traits::memory_space>::memory_space>::accessible>::type
   resize_serial(IntType const& n) {
-    typedef typename traits::value_type local_value_type;
-    typedef local_value_type* value_pointer_type;
-
     const uintptr_t NC =
         (n + m_chunk_mask) >>
         m_chunk_shift;  // New total number of chunks needed for resize
@@ -313,20 +447,18 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     // *m_chunks[m_chunk_max] stores the current number of chunks being used
     uintptr_t* const pc = reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max);
 
-    if (*pc < NC) {
-      while (*pc < NC) {
-        m_chunks[*pc] = reinterpret_cast<value_pointer_type>(
-            typename traits::memory_space().allocate(sizeof(local_value_type)
-                                                     << m_chunk_shift));
-        ++*pc;
-      }
+    const ResizeChunks resize(m_chunks, m_pool, pc, NC, chunk_bytes());
+
+    if (0 < m_pool.capacity()) {
+      // The pool's bookkeeping lives in the view's memory space,
+      // so chunks are taken from and returned to it in a kernel.
+      typedef Kokkos::RangePolicy<typename traits::execution_space> Range;
+      Kokkos::Impl::ParallelFor<ResizeChunks, Range> closure(resize,
+                                                             Range(0, 1));
+      closure.execute();
+      typename traits::execution_space().fence();
     } else {
-      while (NC + 1 <= *pc) {
-        --*pc;
-        typename traits::memory_space().deallocate(
-            m_chunks[*pc], sizeof(local_value_type) << m_chunk_shift);
-        m_chunks[*pc] = nullptr;
-      }
+      resize(0);
     }
     // *m_chunks[m_chunk_max+1] stores the 'extent' requested by resize
     *(pc + 1) = n;
@@ -348,7 +480,8 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
         m_chunk_shift(rhs.m_chunk_shift),
         m_chunk_mask(rhs.m_chunk_mask),
         m_chunk_max(rhs.m_chunk_max),
-        m_chunk_size(rhs.m_chunk_size) {
+        m_chunk_size(rhs.m_chunk_size),
+        m_pool(compatible_pool(rhs.m_pool)) {
     typedef typename DynamicView<RT, RP...>::traits SrcTraits;
     typedef Kokkos::Impl::ViewMapping<traits, SrcTraits, void> Mapping;
     static_assert(Mapping::is_assignable,
@@ -357,21 +490,69 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
 
   //----------------------------------------------------------------------
 
+  // Grow or shrink the chunk array to a new number of chunks.
+  struct ResizeChunks {
+    typename traits::value_type** m_chunks;
+    memory_pool m_pool;
+    uintptr_t* m_count;
+    uintptr_t m_count_new;
+    size_t m_chunk_bytes;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(int) const {
+      while (*m_count < m_count_new) {
+        m_chunks[*m_count] = allocate_chunk(m_pool, m_chunk_bytes);
+        if (nullptr == m_chunks[*m_count]) {
+          Kokkos::abort("DynamicView::resize_serial out of memory");
+        }
+        ++*m_count;
+      }
+      while (m_count_new + 1 <= *m_count) {
+        --*m_count;
+        deallocate_chunk(m_pool, m_chunks[*m_count], m_chunk_bytes);
+        m_chunks[*m_count] = nullptr;
+      }
+    }
+
+    ResizeChunks(typename traits::value_type** arg_chunks,
+                 const memory_pool& arg_pool, uintptr_t* const arg_count,
+                 const uintptr_t arg_count_new, const size_t arg_chunk_bytes)
+        : m_chunks(arg_chunks),
+          m_pool(arg_pool),
+          m_count(arg_count),
+          m_count_new(arg_count_new),
+          m_chunk_bytes(arg_chunk_bytes) {}
+  };
+
   struct Destroy {
+    struct PoolTag {};
+
     typename traits::value_type** m_chunks;
     unsigned m_chunk_max;
     bool m_destroy;
     unsigned m_chunk_size;
+    memory_pool m_pool;
 
     // Initialize or destroy array of chunk pointers.
     // Two entries beyond the max chunks are allocation counters.
+    // Chunks taken from a memory pool are returned on the execution space.
     inline void operator()(unsigned i) const {
-      if (m_destroy && i < m_chunk_max && nullptr != m_chunks[i]) {
-        typename traits::memory_space().deallocate(m_chunks[i], m_chunk_size);
+      if (m_destroy && 0 == m_pool.capacity() && i < m_chunk_max &&
+          nullptr != m_chunks[i]) {
+        deallocate_chunk(m_pool, m_chunks[i],
+                         sizeof(typename traits::value_type) * m_chunk_size);
       }
       m_chunks[i] = nullptr;
     }
 
+    KOKKOS_INLINE_FUNCTION
+    void operator()(PoolTag, unsigned i) const {
+      if (nullptr != m_chunks[i]) {
+        deallocate_chunk(m_pool, m_chunks[i],
+                         sizeof(typename traits::value_type) * m_chunk_size);
+      }
+    }
+
     void execute(bool arg_destroy) {
       typedef Kokkos::RangePolicy<typename HostSpace::execution_space> Range;
       // typedef Kokkos::RangePolicy< typename Impl::ChunkArraySpace< typename
@@ -379,6 +560,18 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
 
       m_destroy = arg_destroy;
 
+      if (m_destroy && 0 < m_pool.capacity()) {
+        typedef Kokkos::RangePolicy<typename traits::execution_space, PoolTag>
+            PoolRange;
+
+        Kokkos::Impl::ParallelFor<Destroy, PoolRange> closure(
+            *this, PoolRange(0, m_chunk_max));
+
+        closure.execute();
+
+        typename traits::execution_space().fence();
+      }
+
       Kokkos::Impl::ParallelFor<Destroy, Range> closure(
           *this,
           Range(0, m_chunk_max + 2));  // Add 2 to 'destroy' extra slots storing
@@ -402,11 +595,13 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     Destroy& operator=(const Destroy&) = default;
 
     Destroy(typename traits::value_type** arg_chunk,
-            const unsigned arg_chunk_max, const unsigned arg_chunk_size)
+            const unsigned arg_chunk_max, const unsigned arg_chunk_size,
+            const memory_pool& arg_pool)
         : m_chunks(arg_chunk),
           m_chunk_max(arg_chunk_max),
           m_destroy(false),
-          m_chunk_size(arg_chunk_size) {}
+          m_chunk_size(arg_chunk_size),
+          m_pool(arg_pool) {}
   };
 
   /**\brief  Allocation constructor
@@ -414,10 +609,14 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
    *  Memory is allocated in chunks
    *  A maximum size is required in order to allocate a
    *  chunk-pointer array.
+   *  If a memory pool is given all chunks are allocated from it,
+   *  which allows growth inside parallel regions on any execution
+   *  space; its maximum block size must hold a chunk.
    */
   explicit inline DynamicView(const std::string& arg_label,
                               const unsigned min_chunk_size,
-                              const unsigned max_extent)
+                              const unsigned max_extent,
+                              const memory_pool& arg_pool = memory_pool())
       : m_track(),
         m_chunks(nullptr)
         // The chunk size is guaranteed to be a power of two
@@ -430,7 +629,14 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
         m_chunk_max((max_extent + m_chunk_mask) >>
                     m_chunk_shift)  // max num pointers-to-chunks in array
         ,
-        m_chunk_size(2 << (m_chunk_shift - 1)) {
+        m_chunk_size(2 << (m_chunk_shift - 1)),
+        m_pool(arg_pool) {
+    if (0 < m_pool.capacity() && m_pool.max_block_size() < chunk_bytes()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "DynamicView chunk size exceeds the memory pool's maximum block "
+          "size");
+    }
+
     typedef typename Impl::ChunkArraySpace<
         typename traits::memory_space>::memory_space chunk_array_memory_space;
     // A functor to deallocate all of the chunks upon final destruction
@@ -448,7 +654,7 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
 
     m_chunks = reinterpret_cast<pointer_type*>(record->data());
 
-    record->m_destroy = Destroy(m_chunks, m_chunk_max, m_chunk_size);
+    record->m_destroy = Destroy(m_chunks, m_chunk_max, m_chunk_size, m_pool);
 
     // Initialize to zero
     record->m_destroy.construct_shared_allocation();
@@ -457,6 +663,95 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
   }
 };
 
+namespace Impl {
+
+// Copy one chunk per team into a contiguous view
+template <class DstType, class SrcType>
+struct DynamicViewCompact {
+  typedef typename SrcType::traits::execution_space execution_space;
+  typedef Kokkos::TeamPolicy<execution_space> policy_type;
+  typedef typename policy_type::member_type member_type;
+
+  DstType m_dst;
+  SrcType m_src;
+  size_t m_size;
+
+  DynamicViewCompact(const DstType& dst, const SrcType& src)
+      : m_dst(dst), m_src(src), m_size(src.size()) {
+    const size_t nchunk = (m_size + m_src.m_chunk_mask) >> m_src.m_chunk_shift;
+    if (nchunk) {
+      Kokkos::parallel_for("Kokkos::DynamicView::compact",
+                           policy_type(nchunk, Kokkos::AUTO), *this);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& team) const {
+    const size_t ic    = team.league_rank();
+    const size_t begin = ic << m_src.m_chunk_shift;
+    const size_t end   = m_size < begin + m_src.m_chunk_size
+                           ? m_size
+                           : begin + m_src.m_chunk_size;
+
+    const typename SrcType::traits::value_type* const chunk =
+        m_src.m_chunks[ic];
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, begin, end),
+                         [&](const size_t i) { m_dst(i) = chunk[i - begin]; });
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Copy all entries of a DynamicView into the leading entries of
+ *          the rank-one View 'dst', one chunk at a time.
+ *
+ *  'dst' must be accessible from the DynamicView's execution space and
+ *  hold at least src.size() entries.
+ */
+template <class DT, class... DP, class ST, class... SP>
+inline void compact(const Kokkos::View<DT, DP...>& dst,
+                    const DynamicView<ST, SP...>& src) {
+  typedef Kokkos::View<DT, DP...> dst_type;
+  typedef DynamicView<ST, SP...> src_type;
+
+  static_assert(dst_type::rank == 1, "compact requires a rank-one View");
+  static_assert(
+      Kokkos::Impl::SpaceAccessibility<
+          typename src_type::traits::execution_space,
+          typename dst_type::memory_space>::accessible,
+      "compact requires a View accessible from the DynamicView's execution "
+      "space");
+
+  if (dst.extent(0) < src.size()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::compact destination View is too small");
+  }
+
+  Impl::DynamicViewCompact<dst_type, src_type>(dst, src);
+
+  typename src_type::traits::execution_space().fence();
+}
+
+/** \brief  Copy all entries of a DynamicView into a new contiguous View
+ *          of extent src.size() in the same memory space.
+ */
+template <class T, class... P>
+inline Kokkos::View<typename DynamicView<T, P...>::traits::non_const_data_type,
+                    typename DynamicView<T, P...>::traits::device_type>
+compact(const std::string& label, const DynamicView<T, P...>& src) {
+  typedef DynamicView<T, P...> src_type;
+  typedef Kokkos::View<typename src_type::traits::non_const_data_type,
+                       typename src_type::traits::device_type>
+      dst_type;
+
+  dst_type dst(Kokkos::ViewAllocateWithoutInitializing(label), src.size());
+
+  compact(dst, src);
+
+  return dst;
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
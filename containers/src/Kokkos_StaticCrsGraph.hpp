@@ -51,6 +51,7 @@
 #include <Kokkos_View.hpp>
 #include <Kokkos_Parallel.hpp>
 #include <Kokkos_Parallel_Reduce.hpp>
+#include <Kokkos_Core.hpp>
 
 namespace Kokkos {
 
@@ -130,6 +131,65 @@ struct StaticCrsGraphBalancerFunctor {
     }
   }
 };
+
+/* Merge path partitioning: the rows (each costing cost_per_row) and the
+ * entries form one sequence of work that is cut into num_blocks equal
+ * parts.  Block b starts after the first row_block_offsets(b) rows and
+ * entry_block_offsets(b) entries, found by a binary search on the rows,
+ * so a long row is split across blocks.
+ */
+template <class RowOffsetsType, class BlockOffsetsType>
+struct StaticCrsGraphMergePathFunctor {
+  typedef typename RowOffsetsType::non_const_value_type int_type;
+  RowOffsetsType row_offsets;
+  BlockOffsetsType row_block_offsets;
+  BlockOffsetsType entry_block_offsets;
+
+  int_type cost_per_row, num_blocks;
+
+  StaticCrsGraphMergePathFunctor(RowOffsetsType row_offsets_,
+                                 BlockOffsetsType row_block_offsets_,
+                                 BlockOffsetsType entry_block_offsets_,
+                                 int_type cost_per_row_, int_type num_blocks_)
+      : row_offsets(row_offsets_),
+        row_block_offsets(row_block_offsets_),
+        entry_block_offsets(entry_block_offsets_),
+        cost_per_row(cost_per_row_),
+        num_blocks(num_blocks_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int_type& iBlock) const {
+    const int_type num_rows    = row_offsets.extent(0) - 1;
+    const int_type num_entries = row_offsets(num_rows);
+    const size_t total_cost =
+        size_t(num_entries) + size_t(num_rows) * cost_per_row;
+
+    const size_t cost = total_cost * iBlock / num_blocks;
+
+    // Largest number of complete rows within the cost, the first block
+    // starts with the rows that cost nothing
+    int_type lo = 0;
+    int_type hi = 0 < iBlock ? num_rows : 0;
+    while (lo < hi) {
+      const int_type mid = hi - (hi - lo) / 2;
+      if (size_t(row_offsets(mid)) + size_t(mid) * cost_per_row <= cost) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+
+    int_type entry = num_entries;
+    if (lo < num_rows) {
+      const size_t rest = cost - size_t(lo) * cost_per_row;
+      entry = rest < size_t(row_offsets(lo + 1)) ? int_type(rest)
+                                                 : row_offsets(lo + 1);
+    }
+
+    row_block_offsets(iBlock)   = lo;
+    entry_block_offsets(iBlock) = entry;
+  }
+};
 }  // namespace Impl
 
 /// \class GraphRowViewConst
@@ -326,22 +386,29 @@ class StaticCrsGraph {
   entries_type entries;
   row_map_type row_map;
   row_block_type row_block_offsets;
+  // Empty unless the partitioning splits rows between blocks
+  row_block_type entry_block_offsets;
 
   //! Construct an empty view.
   KOKKOS_INLINE_FUNCTION
-  StaticCrsGraph() : entries(), row_map(), row_block_offsets() {}
+  StaticCrsGraph()
+      : entries(), row_map(), row_block_offsets(), entry_block_offsets() {}
 
   //! Copy constructor (shallow copy).
   KOKKOS_INLINE_FUNCTION
   StaticCrsGraph(const StaticCrsGraph& rhs)
       : entries(rhs.entries),
         row_map(rhs.row_map),
-        row_block_offsets(rhs.row_block_offsets) {}
+        row_block_offsets(rhs.row_block_offsets),
+        entry_block_offsets(rhs.entry_block_offsets) {}
 
   template <class EntriesType, class RowMapType>
   KOKKOS_INLINE_FUNCTION StaticCrsGraph(const EntriesType& entries_,
                                         const RowMapType& row_map_)
-      : entries(entries_), row_map(row_map_), row_block_offsets() {}
+      : entries(entries_),
+        row_map(row_map_),
+        row_block_offsets(),
+        entry_block_offsets() {}
 
   /** \brief  Assign to a view of the rhs array.
    *          If the old view is the last view
@@ -349,9 +416,10 @@ class StaticCrsGraph {
    */
   KOKKOS_INLINE_FUNCTION
   StaticCrsGraph& operator=(const StaticCrsGraph& rhs) {
-    entries           = rhs.entries;
-    row_map           = rhs.row_map;
-    row_block_offsets = rhs.row_block_offsets;
+    entries             = rhs.entries;
+    row_map             = rhs.row_map;
+    row_block_offsets   = rhs.row_block_offsets;
+    entry_block_offsets = rhs.entry_block_offsets;
     return *this;
   }
 
@@ -419,7 +487,49 @@ class StaticCrsGraph {
                          partitioner);
     typename device_type::execution_space().fence();
 
-    row_block_offsets = block_offsets;
+    row_block_offsets   = block_offsets;
+    entry_block_offsets = row_block_type();
+  }
+
+  /**  \brief  Create a merge path partitioning into a given number of
+   *           blocks of equal non-zeros + a fixed cost per row, splitting
+   *           long rows between blocks.
+   *
+   *  Block b handles the entries block_entries(b) of the rows
+   *  row_block_offsets(b) up to row_block_offsets(b + 1), the latter
+   *  included if the block ends inside it.  The first and last row of a
+   *  block may be shared with the neighbouring blocks.
+   */
+  void create_merge_path_partitioning(size_type num_blocks,
+                                      size_type fix_cost_per_row = 1) {
+    View<size_type*, array_layout, device_type> block_offsets(
+        "StatisCrsGraph::load_balance_offsets", num_blocks + 1);
+    View<size_type*, array_layout, device_type> entry_offsets(
+        "StatisCrsGraph::load_balance_entry_offsets", num_blocks + 1);
+
+    Impl::StaticCrsGraphMergePathFunctor<
+        row_map_type, View<size_type*, array_layout, device_type> >
+        partitioner(row_map, block_offsets, entry_offsets, fix_cost_per_row,
+                    num_blocks);
+
+    Kokkos::parallel_for(
+        "Kokkos::StaticCrsGraph::create_merge_path_partitioning",
+        Kokkos::RangePolicy<execution_space>(0, num_blocks + 1), partitioner);
+    typename device_type::execution_space().fence();
+
+    row_block_offsets   = block_offsets;
+    entry_block_offsets = entry_offsets;
+  }
+
+  /**  \brief  Range of entries handled by block b of the partitioning.
+   */
+  KOKKOS_INLINE_FUNCTION
+  Kokkos::pair<size_type, size_type> block_entries(const size_type b) const {
+    return entry_block_offsets.extent(0) == 0
+               ? Kokkos::make_pair(row_map(row_block_offsets(b)),
+                                   row_map(row_block_offsets(b + 1)))
+               : Kokkos::make_pair(entry_block_offsets(b),
+                                   entry_block_offsets(b + 1));
   }
 };
 
@@ -434,6 +544,11 @@ typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
     const std::string& label,
     const std::vector<std::vector<InputSizeType> >& input);
 
+template <class StaticCrsGraphType, class RowsType, class ColsType>
+typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, const size_t nrows, const RowsType& rows,
+    const ColsType& cols);
+
 //----------------------------------------------------------------------------
 
 template <class DataType, class Arg1Type, class Arg2Type,
@@ -533,4 +648,227 @@ DataType maximum_entry(const StaticCrsGraph<DataType, Arg1Type, Arg2Type,
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+namespace Kokkos {
+namespace Impl {
+
+template <class GraphType, class CompressedType>
+struct CompressStaticCrsGraph {
+  typedef typename GraphType::execution_space execution_space;
+  typedef typename CompressedType::size_type size_type;
+  typedef typename CompressedType::data_type data_type;
+  typedef typename CompressedType::offset_type offset_type;
+  typedef typename CompressedType::array_layout array_layout;
+
+  typedef View<offset_type*, array_layout, typename CompressedType::device_type>
+      offsets_type;
+  typedef View<data_type*, array_layout, typename CompressedType::device_type>
+      values_type;
+  typedef View<size_type*, array_layout, typename CompressedType::device_type>
+      counts_type;
+
+  struct Count {};
+  struct Fill {};
+
+  GraphType graph;
+  offsets_type offsets;
+  values_type row_base;
+  counts_type counts;
+  values_type escapes;
+
+  CompressStaticCrsGraph(const GraphType& graph_, CompressedType& output)
+      : graph(graph_),
+        row_base(ViewAllocateWithoutInitializing(
+                     "Kokkos::CompressedStaticCrsGraph::row_base"),
+                 graph_.numRows()),
+        counts(ViewAllocateWithoutInitializing(
+                   "Kokkos::CompressedStaticCrsGraph::counts"),
+               graph_.numRows()) {
+    const size_type nrows = graph.numRows();
+
+    Kokkos::parallel_for(
+        "Kokkos::CompressedStaticCrsGraph::count",
+        Kokkos::RangePolicy<execution_space, Count>(0, nrows), *this);
+
+    counts_type escape_map;
+    const size_type nescapes = Kokkos::get_crs_row_map_from_counts(
+        escape_map, counts, "Kokkos::CompressedStaticCrsGraph::escape_map");
+    counts  = escape_map;
+    escapes = values_type(ViewAllocateWithoutInitializing(
+                              "Kokkos::CompressedStaticCrsGraph::escapes"),
+                          nescapes);
+    // Escaped rows have no offsets
+    offsets = offsets_type(ViewAllocateWithoutInitializing(
+                               "Kokkos::CompressedStaticCrsGraph::offsets"),
+                           graph.entries.extent(0) - nescapes);
+
+    Kokkos::parallel_for(
+        "Kokkos::CompressedStaticCrsGraph::fill",
+        Kokkos::RangePolicy<execution_space, Fill>(0, nrows), *this);
+    execution_space().fence();
+
+    output.row_map        = graph.row_map;
+    output.offsets        = offsets;
+    output.row_base       = row_base;
+    output.row_escape_map = escape_map;
+    output.escapes        = escapes;
+  }
+
+  // A row is escaped if its indices span more than offset_type holds
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Count, const size_type r) const {
+    const size_type begin = graph.row_map(r);
+    const size_type end   = graph.row_map(r + 1);
+    data_type lo          = begin < end ? graph.entries(begin) : 0;
+    data_type hi          = lo;
+    for (size_type j = begin + 1; j < end; ++j) {
+      const data_type c = graph.entries(j);
+      if (c < lo) lo = c;
+      if (hi < c) hi = c;
+    }
+    const size_t max_offset = offset_type(~offset_type(0));
+    row_base(r)             = lo;
+    counts(r) = size_t(hi) - size_t(lo) <= max_offset ? 0 : end - begin;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Fill, const size_type r) const {
+    const size_type begin  = graph.row_map(r);
+    const size_type end    = graph.row_map(r + 1);
+    const size_type escape = counts(r);
+    if (escape < counts(r + 1)) {
+      for (size_type j = begin; j < end; ++j) {
+        escapes(escape + j - begin) = graph.entries(j);
+      }
+    } else {
+      // Offsets of row r start after those of the rows before it,
+      // less the entries of the escaped rows among them
+      const data_type base = row_base(r);
+      for (size_type j = begin; j < end; ++j) {
+        offsets(j - escape) = offset_type(graph.entries(j) - base);
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \class CompressedGraphRowViewConst
+/// \brief View of a row of a CompressedStaticCrsGraph.
+///
+/// This has the interface of GraphRowViewConst, except that the column
+/// indices are returned by value, decoded from the row's base index and
+/// the narrow offsets on the fly.
+template <class GraphType>
+struct CompressedGraphRowViewConst {
+  //! The type of the column indices in the row.
+  typedef const typename GraphType::data_type ordinal_type;
+  typedef typename GraphType::offset_type offset_type;
+
+ private:
+  const offset_type* offsets_;
+  //! Full width column indices if the row is escaped, else nullptr
+  ordinal_type* escapes_;
+  ordinal_type base_;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  CompressedGraphRowViewConst(const offset_type* const offsets,
+                              ordinal_type* const escapes,
+                              const ordinal_type& base,
+                              const ordinal_type& count)
+      : offsets_(offsets), escapes_(escapes), base_(base), length(count) {}
+
+  //! Number of entries in the row.
+  const ordinal_type length;
+
+  //! Column index of entry i in this row.
+  KOKKOS_INLINE_FUNCTION
+  typename GraphType::data_type colidx(const ordinal_type& i) const {
+    return escapes_ != nullptr ? escapes_[i] : base_ + offsets_[i];
+  }
+
+  //! An alias for colidx
+  KOKKOS_INLINE_FUNCTION
+  typename GraphType::data_type operator()(const ordinal_type& i) const {
+    return colidx(i);
+  }
+};
+
+/// \class CompressedStaticCrsGraph
+/// \brief Read only copy of a StaticCrsGraph storing the column indices
+///   of every row as narrow offsets from the smallest index of the row.
+///
+/// Rows whose indices span more than \c OffsetType can hold are escaped
+/// and keep their indices at full width in a separate array instead of
+/// in \c offsets, so the offsets of row i start at
+/// row_map(i) - row_escape_map(i).  The row map is shared with the
+/// original graph.  For graphs with local column indices, such as mesh
+/// graphs, traversals read half (2 byte offsets) or a quarter (1 byte
+/// offsets) of the index bytes of 4 byte indices.
+template <class GraphType, class OffsetType = uint16_t>
+class CompressedStaticCrsGraph {
+ public:
+  typedef typename std::remove_const<typename GraphType::data_type>::type
+      data_type;
+  typedef typename GraphType::array_layout array_layout;
+  typedef typename GraphType::execution_space execution_space;
+  typedef typename GraphType::device_type device_type;
+  typedef typename GraphType::size_type size_type;
+  typedef OffsetType offset_type;
+
+  static_assert(std::is_integral<data_type>::value,
+                "CompressedStaticCrsGraph requires integral column indices");
+  static_assert(std::is_unsigned<offset_type>::value,
+                "CompressedStaticCrsGraph requires unsigned offsets");
+  static_assert(GraphType::entries_type::rank == 1,
+                "Graph entries view must be rank one");
+
+  typedef typename GraphType::row_map_type row_map_type;
+  typedef View<const offset_type*, array_layout, device_type> offsets_type;
+  typedef View<const data_type*, array_layout, device_type> row_base_type;
+  typedef View<const size_type*, array_layout, device_type> row_escape_type;
+  typedef View<const data_type*, array_layout, device_type> escapes_type;
+
+  row_map_type row_map;
+  offsets_type offsets;
+  row_base_type row_base;
+  row_escape_type row_escape_map;
+  escapes_type escapes;
+
+  KOKKOS_DEFAULTED_FUNCTION CompressedStaticCrsGraph() = default;
+
+  explicit CompressedStaticCrsGraph(const GraphType& graph) {
+    Kokkos::Impl::CompressStaticCrsGraph<GraphType, CompressedStaticCrsGraph>
+        compress(graph, *this);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_type numRows() const {
+    return (row_map.extent(0) != 0)
+               ? row_map.extent(0) - static_cast<size_type>(1)
+               : static_cast<size_type>(0);
+  }
+
+  /// \brief Return a const view of row i of the graph.
+  KOKKOS_INLINE_FUNCTION
+  CompressedGraphRowViewConst<CompressedStaticCrsGraph> rowConst(
+      const data_type i) const {
+    const size_type start  = row_map(i);
+    const data_type count  = static_cast<data_type>(row_map(i + 1) - start);
+    const size_type escape = row_escape_map(i);
+    return CompressedGraphRowViewConst<CompressedStaticCrsGraph>(
+        offsets.data() + (start - escape),
+        escape < row_escape_map(i + 1) ? escapes.data() + escape : nullptr,
+        row_base(i), count);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
 #endif /* #ifndef KOKKOS_CRSARRAY_HPP */
@@ -52,6 +52,9 @@
  * Most functions only work on the host (it will not compile if called from
  * device kernel)
  *
+ * The vector is host first: growth moves the entries into the new host view
+ * with the parallel host deep copy, and the device view is reallocated to
+ * the same extent without copying; its entries follow on the next sync.
  */
 namespace Kokkos {
 
@@ -71,6 +74,96 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
   size_t _size;
   float _extra_storage;
   typedef DualView<Scalar*, LayoutLeft, Arg1Type> DV;
+  typedef Kokkos::pair<size_t, size_t> range_type;
+
+  // Overlapping moves below this many bytes are done in place serially,
+  // larger ones go through a temporary with the parallel host deep copy
+  enum : size_t { serial_move_bytes = 10 * 8192 };
+
+  // Reallocate the host view with 'n' entries keeping the entries
+  // [0, split) in place and moving [split, _size) up by 'gap'.
+  // The device view keeps the host extent so that the inherited DualView
+  // sync, which copies whole views, stays valid; it is reallocated
+  // without initialization since its contents are stale until synced.
+  void realloc_host(const size_t n, const size_t split = 0,
+                    const size_t gap = 0) {
+    DV::sync_host();
+
+    typename DV::t_host h_new(
+        Kokkos::ViewAllocateWithoutInitializing(DV::h_view.label()), n);
+
+    if (0 < split) {
+      deep_copy(subview(h_new, range_type(0, split)),
+                subview(DV::h_view, range_type(0, split)));
+    }
+    if (split < _size) {
+      deep_copy(subview(h_new, range_type(split + gap, _size + gap)),
+                subview(DV::h_view, range_type(split, _size)));
+    }
+
+    DV::h_view = h_new;
+
+    if (std::is_same<typename DV::t_host::memory_space,
+                     typename DV::t_dev::memory_space>::value) {
+      DV::d_view = create_mirror_view(typename DV::t_dev::execution_space(),
+                                      DV::h_view);
+    } else {
+      match_device_extent();
+    }
+
+    DV::modify_host();
+  }
+
+  // Capacity for implicit growth grows geometrically
+  size_t grown_span(const size_t n) const {
+    size_t n_span = size_t(n * _extra_storage);
+    if (n_span < 2 * span()) n_span = 2 * span();
+    return n_span < n ? n : n_span;
+  }
+
+  // Move host entries [src, src + n) to [dst, dst + n), which may overlap
+  void move_host(const size_t dst, const size_t src, const size_t n) {
+    if (0 == n || dst == src) return;
+
+    auto to   = subview(DV::h_view, range_type(dst, dst + n));
+    auto from = subview(DV::h_view, range_type(src, src + n));
+
+    if (n <= (dst < src ? src - dst : dst - src)) {
+      deep_copy(to, from);
+    } else if (n * sizeof(Scalar) < serial_move_bytes) {
+      if (dst < src) {
+        std::copy(from.data(), from.data() + n, to.data());
+      } else {
+        std::copy_backward(from.data(), from.data() + n, to.data() + n);
+      }
+    } else {
+      typename DV::t_host tmp(
+          Kokkos::ViewAllocateWithoutInitializing("Kokkos::vector::move"), n);
+      deep_copy(tmp, from);
+      deep_copy(to, tmp);
+    }
+  }
+
+  // Open a gap of 'count' entries at 'start', growing if necessary
+  void make_room(const size_t start, const size_t count) {
+    if (span() < _size + count) {
+      realloc_host(grown_span(_size + count), start, count);
+    } else {
+      move_host(start + count, start, _size - start);
+    }
+    _size += count;
+  }
+
+  // Bring the device view to the extent of the host view, discarding
+  // its contents
+  void match_device_extent() {
+    if (DV::d_view.extent(0) != DV::h_view.extent(0)) {
+      const std::string label = DV::d_view.label();
+      DV::d_view = typename DV::t_dev();
+      DV::d_view = typename DV::t_dev(
+          Kokkos::ViewAllocateWithoutInitializing(label), DV::h_view.extent(0));
+    }
+  }
 
  public:
 #ifdef KOKKOS_ENABLE_CUDA_UVM
@@ -102,7 +195,7 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
   }
 
   void resize(size_t n) {
-    if (n >= span()) DV::resize(size_t(n * _extra_storage));
+    if (n >= span()) realloc_host(size_t(n * _extra_storage), _size);
     _size = n;
   }
 
@@ -111,7 +204,10 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
   void assign(size_t n, const Scalar& val) {
     /* Resize if necessary (behavior of std:vector) */
 
-    if (n > span()) DV::resize(size_t(n * _extra_storage));
+    if (n > span()) {
+      _size = 0;
+      realloc_host(size_t(n * _extra_storage));
+    }
     _size = n;
 
     /* Assign value either on host or on device */
@@ -129,21 +225,42 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
     }
   }
 
-  void reserve(size_t n) { DV::resize(size_t(n * _extra_storage)); }
+  void reserve(size_t n) { realloc_host(size_t(n * _extra_storage), _size); }
 
   void push_back(Scalar val) {
-    DV::template sync<typename DV::t_host::device_type>();
-    DV::template modify<typename DV::t_host::device_type>();
     if (_size == span()) {
-      size_t new_size = _size * _extra_storage;
-      if (new_size == _size) new_size++;
-      DV::resize(new_size);
+      realloc_host(grown_span(_size + 1), _size);
+    } else {
+      DV::sync_host();
+      DV::modify_host();
     }
 
     DV::h_view(_size) = val;
     _size++;
   }
 
+  /** \brief  Append the entries of the rank-one View 'src', which may
+   *          reside in any memory space, with one deep copy.
+   */
+  template <class SrcType>
+  void append_range(const SrcType& src) {
+    static_assert(Kokkos::is_view<SrcType>::value && SrcType::rank == 1,
+                  "Kokkos::vector::append_range requires a rank-one View");
+
+    const size_t n = src.extent(0);
+    if (0 == n) return;
+
+    if (span() < _size + n) {
+      realloc_host(grown_span(_size + n), _size);
+    } else {
+      DV::sync_host();
+      DV::modify_host();
+    }
+
+    deep_copy(subview(DV::h_view, range_type(_size, _size + n)), src);
+    _size += n;
+  }
+
   void pop_back() { _size--; }
 
   void clear() { _size = 0; }
@@ -163,13 +280,26 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
     if (it < begin() || it > end())
       Kokkos::abort("Kokkos::vector::insert : invalid insert iterator");
     if (count == 0) return it;
-    ptrdiff_t start = std::distance(begin(), it);
-    auto org_size   = size();
-    resize(size() + count);
+    const size_t start = std::distance(begin(), it);
+    make_room(start, count);
 
-    std::copy_backward(begin() + start, begin() + org_size,
-                       begin() + org_size + count);
-    std::fill_n(begin() + start, count, val);
+    deep_copy(subview(DV::h_view, range_type(start, start + count)), val);
+
+    return begin() + start;
+  }
+
+  iterator erase(iterator it) { return erase(it, it + 1); }
+
+  iterator erase(iterator first, iterator last) {
+    DV::sync_host();
+    DV::modify_host();
+    if (first < begin() || last > end() || last < first)
+      Kokkos::abort("Kokkos::vector::erase : invalid erase range");
+    const size_t start = std::distance(begin(), first);
+    const size_t count = std::distance(first, last);
+
+    move_host(start, start + count, _size - start - count);
+    _size -= count;
 
     return begin() + start;
   }
@@ -194,19 +324,10 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
     if (it < begin() || it > end())
       Kokkos::abort("Kokkos::vector::insert : invalid insert iterator");
 
-    bool resized = false;
-    if ((size() == 0) && (it == begin())) {
-      resize(count);
-      it      = begin();
-      resized = true;
-    }
-    ptrdiff_t start = std::distance(begin(), it);
-    auto org_size   = size();
-    if (!resized) resize(size() + count);
+    const size_t start = std::distance(begin(), it);
+    make_room(start, count);
     it = begin() + start;
 
-    std::copy_backward(begin() + start, begin() + org_size,
-                       begin() + org_size + count);
     std::copy(b, e, it);
 
     return begin() + start;
@@ -300,8 +421,14 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
 
   /* Additional functions for data management */
 
-  void device_to_host() { deep_copy(DV::h_view, DV::d_view); }
-  void host_to_device() const { deep_copy(DV::d_view, DV::h_view); }
+  void device_to_host() {
+    match_device_extent();
+    deep_copy(DV::h_view, DV::d_view);
+  }
+  void host_to_device() {
+    match_device_extent();
+    deep_copy(DV::d_view, DV::h_view);
+  }
 
   void on_host() { DV::template modify<typename DV::t_host::device_type>(); }
   void on_device() { DV::template modify<typename DV::t_dev::device_type>(); }
@@ -96,6 +96,108 @@ struct BitsetCount {
   }
 };
 
+template <typename Bitset, typename IndexView>
+struct BitsetCompact {
+  typedef Bitset bitset_type;
+  typedef
+      typename bitset_type::execution_space::execution_space execution_space;
+  typedef typename bitset_type::size_type size_type;
+  typedef size_type value_type;
+
+  enum { block_size = static_cast<unsigned>(sizeof(unsigned) * CHAR_BIT) };
+
+  bitset_type m_bitset;
+  IndexView m_indices;
+
+  BitsetCompact(bitset_type const& bitset, IndexView const& indices)
+      : m_bitset(bitset), m_indices(indices) {}
+
+  size_type apply() const {
+    size_type count = 0u;
+    parallel_scan("Kokkos::Impl::BitsetCompact::apply",
+                  RangePolicy<execution_space>(0, m_bitset.m_blocks.extent(0)),
+                  *this, count);
+    return count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& count) const { count = 0u; }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& count, const volatile size_type& incr) const {
+    count += incr;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i, value_type& offset, bool final) const {
+    unsigned block = m_bitset.m_blocks[i];
+    if (final) {
+      // peel the set bits of the block off lowest first
+      for (size_type n = offset; block; ++n, block &= block - 1u) {
+        if (n < m_indices.extent(0)) {
+          m_indices(n) = i * block_size + bit_scan_forward(block);
+        }
+      }
+      block = m_bitset.m_blocks[i];
+    }
+    offset += bit_count(block);
+  }
+};
+
+template <typename Bitset, typename ConstBitset, typename Op>
+struct BitsetAssign {
+  typedef Bitset bitset_type;
+  typedef ConstBitset const_bitset_type;
+  typedef
+      typename bitset_type::execution_space::execution_space execution_space;
+  typedef typename bitset_type::size_type size_type;
+  typedef size_type value_type;
+
+  bitset_type m_dst;
+  const_bitset_type m_src;
+
+  BitsetAssign(bitset_type const& dst, const_bitset_type const& src)
+      : m_dst(dst), m_src(src) {}
+
+  size_type apply() const {
+    size_type count = 0u;
+    parallel_reduce("Kokkos::Impl::BitsetAssign::apply",
+                    RangePolicy<execution_space>(0, m_dst.m_blocks.extent(0)),
+                    *this, count);
+    return count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& count) const { count = 0u; }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& count, const volatile size_type& incr) const {
+    count += incr;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i, value_type& count) const {
+    const unsigned block = Op::apply(m_dst.m_blocks[i], m_src.m_blocks[i]);
+    m_dst.m_blocks[i]    = block;
+    count += bit_count(block);
+  }
+};
+
+struct BitsetAnd {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a & b; }
+};
+
+struct BitsetOr {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a | b; }
+};
+
+struct BitsetXor {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a ^ b; }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
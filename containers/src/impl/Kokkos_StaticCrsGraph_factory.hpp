@@ -105,17 +105,21 @@ create_mirror(const StaticCrsGraph<DataType, Arg1Type, Arg2Type, Arg3Type,
       create_mirror(view.row_map);
   typename staticcrsgraph_type::row_block_type::HostMirror
       tmp_row_block_offsets = create_mirror(view.row_block_offsets);
+  typename staticcrsgraph_type::row_block_type::HostMirror
+      tmp_entry_block_offsets = create_mirror(view.entry_block_offsets);
 
   // Allocation to match:
   tmp.row_map = tmp_row_map;  // Assignment of 'const' from 'non-const'
   tmp.entries = create_mirror(view.entries);
   tmp.row_block_offsets =
       tmp_row_block_offsets;  // Assignment of 'const' from 'non-const'
+  tmp.entry_block_offsets = tmp_entry_block_offsets;
 
   // Deep copy:
   deep_copy(tmp_row_map, view.row_map);
   deep_copy(tmp.entries, view.entries);
   deep_copy(tmp_row_block_offsets, view.row_block_offsets);
+  deep_copy(tmp_entry_block_offsets, view.entry_block_offsets);
 
   return tmp;
 }
@@ -249,6 +253,48 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
   return output;
 }
 
+//----------------------------------------------------------------------------
+
+/** \brief  Build a graph in parallel from the unsorted coordinate pairs
+ *          (rows(i), cols(i)), with 0 <= rows(i) < nrows.
+ *
+ *  The entries of every row are sorted and duplicates are removed.
+ */
+template <class StaticCrsGraphType, class RowsType, class ColsType>
+inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, const size_t nrows, const RowsType& rows,
+    const ColsType& cols) {
+  typedef StaticCrsGraphType output_type;
+  typedef typename output_type::entries_type entries_type;
+
+  static_assert(entries_type::rank == 1, "Graph entries view must be rank one");
+  static_assert(RowsType::rank == 1 && ColsType::rank == 1,
+                "Coordinate row and column views must be rank one");
+
+  typedef View<typename output_type::size_type[],
+               typename output_type::array_layout,
+               typename output_type::execution_space,
+               typename output_type::memory_traits>
+      work_type;
+
+  if (rows.extent(0) != cols.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::create_staticcrsgraph row and column views differ in length");
+  }
+
+  output_type output;
+
+  work_type row_work;
+  entries_type entries;
+  Kokkos::Impl::CrsFromCoo<work_type, entries_type, RowsType, ColsType>
+      functor(row_work, entries, label, nrows, rows, cols);
+
+  output.entries = entries;
+  output.row_map = row_work;
+
+  return output;
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -177,6 +177,29 @@ struct TestBitsetAny {
     }
   }
 };
+
+template <typename Bitset>
+struct TestBitsetModSet {
+  typedef Bitset bitset_type;
+  typedef typename bitset_type::execution_space execution_space;
+
+  bitset_type m_bitset;
+  unsigned m_mod;
+
+  TestBitsetModSet(bitset_type const& bitset, unsigned mod)
+      : m_bitset(bitset), m_mod(mod) {}
+
+  void apply() {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space>(0, m_bitset.size()), *this);
+    execution_space().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(uint32_t i) const {
+    if (i % m_mod == 0) m_bitset.set(i);
+  }
+};
 }  // namespace Impl
 
 template <typename Device>
@@ -253,9 +276,63 @@ void test_bitset() {
   }
 }
 
+template <typename Device>
+void test_bitset_bulk() {
+  typedef Kokkos::Bitset<Device> bitset_type;
+  typedef Kokkos::ConstBitset<Device> const_bitset_type;
+  typedef Kokkos::View<unsigned*, Device> index_view;
+
+  const unsigned n = 1000u;
+
+  bitset_type threes(n), fives(n), result(n);
+  Impl::TestBitsetModSet<bitset_type>(threes, 3u).apply();
+  Impl::TestBitsetModSet<bitset_type>(fives, 5u).apply();
+
+  // multiples of 15, of 3 or 5, and of exactly one of them below n
+  const unsigned n_and = 67u, n_or = 467u;
+
+  Kokkos::deep_copy(result, threes);
+  EXPECT_EQ(n_and, result.bitwise_and(fives));
+  EXPECT_EQ(n_and, result.count());
+
+  index_view indices("indices", n_and);
+  EXPECT_EQ(n_and, const_bitset_type(result).find_all_set(indices));
+
+  typename index_view::HostMirror h_indices =
+      Kokkos::create_mirror_view(indices);
+  Kokkos::deep_copy(h_indices, indices);
+  for (unsigned i = 0; i < n_and; ++i) {
+    ASSERT_EQ(15u * i, h_indices(i));
+  }
+
+  // output shorter than the set only receives the leading indices
+  index_view short_indices("short_indices", 10u);
+  EXPECT_EQ(n_and, result.find_all_set(short_indices));
+  Kokkos::deep_copy(h_indices, 0u);
+  Kokkos::deep_copy(Kokkos::subview(h_indices, std::make_pair(0u, 10u)),
+                    short_indices);
+  for (unsigned i = 0; i < 10u; ++i) {
+    ASSERT_EQ(15u * i, h_indices(i));
+  }
+
+  Kokkos::deep_copy(result, threes);
+  EXPECT_EQ(n_or, result.bitwise_or(fives));
+  EXPECT_EQ(n_or, result.count());
+
+  Kokkos::deep_copy(result, threes);
+  EXPECT_EQ(n_or - n_and, result.bitwise_xor(fives));
+  EXPECT_EQ(n_or - n_and, result.count());
+
+  // xor with itself clears everything including the partial last block
+  EXPECT_EQ(0u, result.bitwise_xor(result));
+  EXPECT_EQ(0u, result.find_all_set(indices));
+}
+
 // FIXME_HIP deadlock
 #ifndef KOKKOS_ENABLE_HIP
 TEST(TEST_CATEGORY, bitset) { test_bitset<TEST_EXECSPACE>(); }
+
+TEST(TEST_CATEGORY, bitset_bulk) { test_bitset_bulk<TEST_EXECSPACE>(); }
 #endif
 }  // namespace Test
 
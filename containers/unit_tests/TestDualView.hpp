@@ -343,6 +343,88 @@ struct test_dualview_realloc {
   }
 };
 
+template <typename Scalar, class Device>
+struct test_dualview_modify_range {
+  typedef Scalar scalar_type;
+  typedef Device execution_space;
+
+  template <typename ViewType>
+  void run_me() {
+    const unsigned int n = 1000;
+    const unsigned int m = 3;
+
+    // Separate allocations make the copied rows observable even when
+    // the device memory is host memory
+    typename ViewType::t_dev d_view("D", n, m);
+    typename ViewType::t_host h_view("H", n, m);
+    ViewType a(d_view, h_view);
+    auto d_mirror = Kokkos::create_mirror(a.d_view);
+
+    Kokkos::deep_copy(a.h_view, 1);
+    a.modify_host(Kokkos::make_pair(10, 20));
+    a.modify_host(Kokkos::make_pair(500, 501));
+    a.sync_device();
+
+    Kokkos::deep_copy(d_mirror, a.d_view);
+    for (unsigned int i = 0; i < n; ++i) {
+      const scalar_type expected = (10 <= i && i < 20) || i == 500 ? 1 : 0;
+      for (unsigned int j = 0; j < m; ++j) {
+        ASSERT_EQ(d_mirror(i, j), expected);
+      }
+    }
+
+    Kokkos::deep_copy(a.d_view, 2);
+    a.modify_device(Kokkos::make_pair(0, 5));
+    a.sync_host();
+
+    for (unsigned int i = 0; i < n; ++i) {
+      for (unsigned int j = 0; j < m; ++j) {
+        ASSERT_EQ(a.h_view(i, j), i < 5 ? 2 : 1);
+      }
+    }
+
+    // Many ranges are coalesced but all their rows are copied
+    Kokkos::deep_copy(a.h_view, 3);
+    for (unsigned int i = 0; i < 20; ++i) {
+      a.modify_host(Kokkos::make_pair(40 * i, 40 * i + 1));
+    }
+    a.sync_device();
+
+    Kokkos::deep_copy(d_mirror, a.d_view);
+    for (unsigned int i = 0; i < 20; ++i) {
+      ASSERT_EQ(d_mirror(40 * i, 0), 3);
+    }
+    ASSERT_EQ(d_mirror(n - 1, 0), 2);
+
+    // Ranges covering most of the rows and unranged modifications fall
+    // back to copying everything
+    Kokkos::deep_copy(a.h_view, 4);
+    a.modify_host(Kokkos::make_pair(0, 600));
+    a.sync_device();
+    Kokkos::deep_copy(d_mirror, a.d_view);
+    ASSERT_EQ(d_mirror(n - 1, m - 1), 4);
+
+    Kokkos::deep_copy(a.h_view, 5);
+    a.modify_host(Kokkos::make_pair(0, 1));
+    a.modify_host();
+    a.sync_device();
+    Kokkos::deep_copy(d_mirror, a.d_view);
+    ASSERT_EQ(d_mirror(n - 1, m - 1), 5);
+
+    // Modifying the other side in between falls back as well
+    Kokkos::deep_copy(a.h_view, 6);
+    a.modify_device(Kokkos::make_pair(0, 1));
+    a.modify_host(Kokkos::make_pair(0, 1));
+    a.sync_device();
+    Kokkos::deep_copy(d_mirror, a.d_view);
+    ASSERT_EQ(d_mirror(n - 1, m - 1), 6);
+  }  // end run_me
+
+  test_dualview_modify_range() {
+    run_me<Kokkos::DualView<Scalar**, Kokkos::LayoutRight, Device> >();
+  }
+};
+
 }  // namespace Impl
 
 template <typename Scalar, typename Device>
@@ -366,6 +448,11 @@ void test_dualview_resize() {
   Impl::test_dualview_resize<Scalar, Device>();
 }
 
+template <typename Scalar, typename Device>
+void test_dualview_modify_range() {
+  Impl::test_dualview_modify_range<Scalar, Device>();
+}
+
 TEST(TEST_CATEGORY, dualview_combination) {
   test_dualview_combinations<int, TEST_EXECSPACE>(10, true);
 }
@@ -387,6 +474,10 @@ TEST(TEST_CATEGORY, dualview_resize) {
   test_dualview_resize<int, TEST_EXECSPACE>();
 }
 
+TEST(TEST_CATEGORY, dualview_modify_range) {
+  test_dualview_modify_range<int, TEST_EXECSPACE>();
+}
+
 }  // namespace Test
 
 #endif  // KOKKOS_TEST_DUALVIEW_HPP
@@ -217,6 +217,96 @@ struct TestDynamicView {
           new_result_sum);
 
       ASSERT_EQ(new_result_sum, (value_type)(da_resize * (da_resize - 1) / 2));
+#endif
+    }  // end scope
+  }
+
+  static void run_concurrent(unsigned arg_total_size) {
+    typedef typename view_type::memory_pool pool_type;
+
+    const unsigned chunk_size = 1024;
+    const size_t chunk_bytes  = sizeof(Scalar) * chunk_size;
+
+    // Test: Append from within a parallel_for with chunks taken from a
+    // memory pool, check values of the compacted View (via parallel_reduce)
+    {
+      pool_type pool(memory_space(), 4 * sizeof(Scalar) * arg_total_size,
+                     chunk_bytes, chunk_bytes);
+
+      view_type da("da", chunk_size, arg_total_size, pool);
+      ASSERT_EQ(da.size(), 0);
+
+      // Odd entries are appended once, multiples of six twice
+      size_t expect_size = 0;
+      value_type expect  = 0;
+      for (unsigned i = 0; i < arg_total_size / 2; ++i) {
+        if (i % 2) {
+          expect_size += 1;
+          expect += i;
+        } else if (0 == i % 6) {
+          expect_size += 2;
+          expect += 2 * i;
+        }
+      }
+
+#if defined(KOKKOS_ENABLE_CXX11_DISPATCH_LAMBDA)
+      int errors = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<execution_space>(0, arg_total_size / 2),
+          KOKKOS_LAMBDA(const int i, int& errs) {
+            if (i % 2) {
+              if (view_type::invalid_index == da.push_back(Scalar(i))) ++errs;
+            } else if (0 == i % 6) {
+              const size_t j = da.grow_by(2);
+              if (view_type::invalid_index == j) {
+                ++errs;
+              } else {
+                da(j)     = Scalar(i);
+                da(j + 1) = Scalar(i);
+              }
+            }
+          },
+          errors);
+
+      ASSERT_EQ(errors, 0);
+      ASSERT_EQ(da.size(), expect_size);
+
+      Kokkos::View<Scalar*, Space> compacted =
+          Kokkos::Experimental::compact("compacted", da);
+      ASSERT_EQ(compacted.extent(0), expect_size);
+
+      value_type result_sum = 0.0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<execution_space>(0, expect_size),
+          KOKKOS_LAMBDA(const int i, value_type& partial_sum) {
+            partial_sum += (value_type)compacted(i);
+          },
+          result_sum);
+
+      ASSERT_EQ(result_sum, expect);
+
+      // Fill up to the maximum extent, growing beyond it fails
+      const size_t capacity =
+          size_t((arg_total_size + chunk_size - 1) / chunk_size) * chunk_size;
+      errors = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<execution_space>(0, 1),
+          KOKKOS_LAMBDA(const int, int& errs) {
+            if (expect_size != da.grow_by(capacity - expect_size)) ++errs;
+            if (view_type::invalid_index != da.grow_by(1)) ++errs;
+          },
+          errors);
+
+      ASSERT_EQ(errors, 0);
+      ASSERT_EQ(da.size(), capacity);
+      ASSERT_EQ(da.allocation_extent(), capacity);
+
+      // Shrink and regrow in serial, chunks go back to the pool
+      da.resize_serial(chunk_size);
+      ASSERT_EQ(da.size(), chunk_size);
+      ASSERT_EQ(da.allocation_extent(), chunk_size);
+      da.resize_serial(capacity);
+      ASSERT_EQ(da.allocation_extent(), capacity);
 #endif
     }  // end scope
   }
@@ -230,6 +320,14 @@ TEST(TEST_CATEGORY, dynamic_view) {
   }
 }
 
+TEST(TEST_CATEGORY, dynamic_view_grow_by) {
+  typedef TestDynamicView<double, TEST_EXECSPACE> TestDynView;
+
+  for (int i = 0; i < 4; ++i) {
+    TestDynView::run_concurrent(100000 + 100 * i);
+  }
+}
+
 }  // namespace Test
 
 #endif /* #ifndef KOKKOS_TEST_DYNAMICVIEW_HPP */
@@ -195,6 +195,125 @@ void run_test_graph3(size_t B, size_t N) {
   }
 }
 
+template <class Space>
+void run_test_graph_merge_path(size_t B, size_t C) {
+  typedef Kokkos::StaticCrsGraph<int, Space> dView;
+  typedef typename dView::HostMirror hView;
+  typedef typename dView::size_type size_type;
+  typedef typename Space::execution_space execution_space;
+  typedef Kokkos::TeamPolicy<execution_space> policy_type;
+
+  const unsigned LENGTH = 2000;
+
+  // A few rows hold most of the entries
+  std::vector<size_t> sizes(LENGTH);
+  for (size_t i = 0; i < LENGTH; ++i) {
+    sizes[i] = i % 500 == 3 ? 20000 : i % 7;
+  }
+
+  dView dx = Kokkos::create_staticcrsgraph<dView>("test", sizes);
+  dx.create_merge_path_partitioning(B, C);
+  hView hx = Kokkos::create_mirror(dx);
+
+  const size_t total = hx.row_map(LENGTH) + C * LENGTH;
+  ASSERT_EQ(hx.row_block_offsets(0), 0u);
+  ASSERT_EQ(hx.row_block_offsets(B), LENGTH);
+  for (size_t i = 0; i < B; i++) {
+    const auto entries = hx.block_entries(i);
+    ASSERT_LE(entries.first, entries.second);
+    ASSERT_LE(hx.row_map(hx.row_block_offsets(i)), entries.first);
+    const size_t cost =
+        entries.second - entries.first +
+        C * (hx.row_block_offsets(i + 1) - hx.row_block_offsets(i));
+    ASSERT_LE(cost, total / B + C + 1);
+  }
+
+  // Sum of the entries of every row, with rows split between teams
+  Kokkos::View<size_t*, Space> row_sums("row_sums", LENGTH);
+  Kokkos::parallel_for(
+      policy_type(B, Kokkos::AUTO),
+      KOKKOS_LAMBDA(const typename policy_type::member_type& team) {
+        const size_type b     = team.league_rank();
+        const size_type first = dx.row_block_offsets(b);
+        const size_type last  = dx.row_block_offsets(b + 1);
+        const auto entries    = dx.block_entries(b);
+        const size_type end   = last < LENGTH ? last + 1 : last;
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(team, first, end), [&](const size_type r) {
+              const size_type lo = dx.row_map(r) < entries.first
+                                       ? entries.first
+                                       : dx.row_map(r);
+              const size_type hi = entries.second < dx.row_map(r + 1)
+                                       ? entries.second
+                                       : dx.row_map(r + 1);
+              size_t sum = 0;
+              for (size_type j = lo; j < hi; ++j) sum += dx.entries(j) + 1;
+              if (r < last && entries.first <= dx.row_map(r)) {
+                row_sums(r) = sum;
+              } else if (lo < hi) {
+                Kokkos::atomic_add(&row_sums(r), sum);
+              }
+            });
+      });
+
+  auto h_row_sums = Kokkos::create_mirror_view(row_sums);
+  Kokkos::deep_copy(h_row_sums, row_sums);
+  for (size_t i = 0; i < LENGTH; ++i) {
+    ASSERT_EQ(h_row_sums(i), sizes[i]);
+  }
+}
+
+template <class Space, class OffsetType>
+void run_test_graph_compressed() {
+  typedef Kokkos::StaticCrsGraph<unsigned, Space> dView;
+  typedef Kokkos::Experimental::CompressedStaticCrsGraph<dView, OffsetType>
+      cView;
+  typedef typename Space::execution_space execution_space;
+
+  const unsigned LENGTH = 2000;
+
+  // Local columns, with a few rows spanning 300 or 100000 columns
+  std::vector<std::vector<unsigned> > graph(LENGTH);
+  size_t nescaped_8 = 0, nescaped_16 = 0;
+  for (unsigned i = 0; i < LENGTH; ++i) {
+    for (unsigned j = i < 3 ? 0 : i - 3; j <= i + 3; ++j) {
+      graph[i].push_back(j);
+    }
+    if (i % 100 == 7) {
+      graph[i].push_back(i + 300);
+      nescaped_8 += graph[i].size();
+    } else if (i % 100 == 11) {
+      graph[i].push_back(i + 100000);
+      nescaped_8 += graph[i].size();
+      nescaped_16 += graph[i].size();
+    }
+  }
+
+  dView dx = Kokkos::create_staticcrsgraph<dView>("dx", graph);
+  cView cx(dx);
+
+  ASSERT_EQ(cx.numRows(), LENGTH);
+  ASSERT_EQ(cx.escapes.extent(0),
+            sizeof(OffsetType) == 1 ? nescaped_8 : nescaped_16);
+  ASSERT_EQ(cx.offsets.extent(0) + cx.escapes.extent(0),
+            dx.entries.extent(0));
+
+  size_t errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, LENGTH),
+      KOKKOS_LAMBDA(const unsigned i, size_t& update) {
+        const auto row  = dx.rowConst(i);
+        const auto crow = cx.rowConst(i);
+        if (row.length != crow.length) ++update;
+        for (unsigned j = 0; j < row.length && j < crow.length; ++j) {
+          if (row.colidx(j) != crow.colidx(j)) ++update;
+          if (row(j) != crow(j)) ++update;
+        }
+      },
+      errors);
+  ASSERT_EQ(errors, 0u);
+}
+
 template <class Space>
 void run_test_graph4() {
   typedef unsigned ordinal_type;
@@ -274,6 +393,42 @@ void run_test_graph4() {
                             Kokkos::MemoryUnmanaged>::value));
 }
 
+template <class Space>
+void run_test_graph_coo() {
+  typedef Kokkos::StaticCrsGraph<unsigned, Space> dView;
+  typedef typename dView::HostMirror hView;
+  typedef Kokkos::View<unsigned*, Space> coords_type;
+
+  const unsigned LENGTH = 1000;
+
+  // The graph of run_test_graph, in reverse order and with duplicates
+  coords_type rows("rows", 2 * 8 * LENGTH);
+  coords_type cols("cols", 2 * 8 * LENGTH);
+  typename coords_type::HostMirror h_rows = Kokkos::create_mirror_view(rows);
+  typename coords_type::HostMirror h_cols = Kokkos::create_mirror_view(cols);
+  for (size_t k = 0; k < h_rows.extent(0); ++k) {
+    const size_t i = LENGTH - 1 - (k / 8) % LENGTH;
+    h_rows(k)      = i;
+    h_cols(k)      = i + (7 - k % 8) * 3;
+  }
+  Kokkos::deep_copy(rows, h_rows);
+  Kokkos::deep_copy(cols, h_cols);
+
+  dView dx = Kokkos::create_staticcrsgraph<dView>("dx", LENGTH, rows, cols);
+  hView hx = Kokkos::create_mirror(dx);
+
+  ASSERT_EQ(hx.row_map.extent(0) - 1, LENGTH);
+
+  for (size_t i = 0; i < LENGTH; ++i) {
+    const size_t begin = hx.row_map[i];
+    const size_t n     = hx.row_map[i + 1] - begin;
+    ASSERT_EQ(n, 8u);
+    for (size_t j = 0; j < n; ++j) {
+      ASSERT_EQ(hx.entries(j + begin), i + j * 3);
+    }
+  }
+}
+
 } /* namespace TestStaticCrsGraph */
 
 TEST(TEST_CATEGORY, staticcrsgraph) {
@@ -292,5 +447,12 @@ TEST(TEST_CATEGORY, staticcrsgraph) {
   TestStaticCrsGraph::run_test_graph3<TEST_EXECSPACE>(75, 10000);
   TestStaticCrsGraph::run_test_graph3<TEST_EXECSPACE>(75, 100000);
   TestStaticCrsGraph::run_test_graph4<TEST_EXECSPACE>();
+  TestStaticCrsGraph::run_test_graph_compressed<TEST_EXECSPACE, uint16_t>();
+  TestStaticCrsGraph::run_test_graph_compressed<TEST_EXECSPACE, uint8_t>();
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(1, 1);
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(16, 0);
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(16, 1);
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(75, 4);
+  TestStaticCrsGraph::run_test_graph_coo<TEST_EXECSPACE>();
 }
 }  // namespace Test
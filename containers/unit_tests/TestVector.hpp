@@ -223,6 +223,58 @@ struct test_vector_combinations {
   }
 };
 
+template <typename Scalar, class Device>
+void test_vector_erase_append(const unsigned int size) {
+  typedef Scalar scalar_type;
+  typedef Device execution_space;
+
+  Kokkos::vector<Scalar, Device> a;
+  for (unsigned int i = 0; i < size; i++) a.push_back(scalar_type(i));
+  ASSERT_EQ(a.size(), size);
+
+  // Large overlapping moves go through a temporary, small ones in place
+  const unsigned int n = size / 4;
+  auto it              = a.erase(a.begin() + 1, a.begin() + 1 + n);
+  ASSERT_EQ(a.size(), size - n);
+  ASSERT_EQ(*it, scalar_type(n + 1));
+  a.erase(a.begin());
+  ASSERT_EQ(a.size(), size - n - 1);
+  ASSERT_EQ(a[0], scalar_type(n + 1));
+  ASSERT_EQ(a.back(), scalar_type(size - 1));
+
+  Kokkos::View<Scalar*, Device> src("src", size);
+  Kokkos::parallel_for(Kokkos::RangePolicy<execution_space>(0, size),
+                       KOKKOS_LAMBDA(const int i) { src(i) = -i; });
+  a.append_range(src);
+  ASSERT_EQ(a.size(), 2 * size - n - 1);
+
+  a.insert(a.begin(), n, scalar_type(7));
+  ASSERT_EQ(a.size(), 2 * size - 1);
+
+  for (unsigned int i = 0; i < a.size(); i++) {
+    const scalar_type expected =
+        i < n ? scalar_type(7)
+              : i < size - 1 ? scalar_type(i + 1)
+                             : scalar_type(size - 1) - scalar_type(i);
+    ASSERT_EQ(a[i], expected);
+  }
+
+  // The device view follows the host growth, also when synced
+  // through the DualView base class
+  ASSERT_EQ(a.d_view.extent(0), a.h_view.extent(0));
+  Kokkos::DualView<Scalar*, Kokkos::LayoutLeft, Device>& dv = a;
+  dv.sync_device();
+  ASSERT_EQ(a.d_view.extent(0), a.h_view.extent(0));
+  auto d_view     = a.d_view;
+  scalar_type sum = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, a.size()),
+      KOKKOS_LAMBDA(const int i, scalar_type& s) { s += d_view(i); }, sum);
+  scalar_type reference = 0;
+  for (unsigned int i = 0; i < a.size(); i++) reference += a[i];
+  ASSERT_EQ(sum, reference);
+}
+
 }  // namespace Impl
 
 template <typename Scalar, typename Device>
@@ -240,6 +292,11 @@ TEST(TEST_CATEGORY, vector_insert) {
   Impl::test_vector_insert<int, TEST_EXECSPACE>(3057);
 }
 
+TEST(TEST_CATEGORY, vector_erase_append) {
+  Impl::test_vector_erase_append<int, TEST_EXECSPACE>(10);
+  Impl::test_vector_erase_append<int, TEST_EXECSPACE>(30000);
+}
+
 }  // namespace Test
 
 #endif  // KOKKOS_TEST_UNORDERED_MAP_HPP
@@ -300,6 +300,26 @@ void run_test_mdrange(int exp_beg, int exp_end, const char deviceTypeName[],
           << "\n---------------------------------------------------------------"
           << std::endl;
     }  // end scope test 2
+
+    // Test 1_t: MDRange with default tile dims, autotuned over the first
+    // launches
+    {
+      const int explore    = 20;
+      double seconds_def   = 0;
+      double seconds_tuned = 0;
+      MultiDimRangePerf3D<DeviceType, double, LayoutType>::
+          test_multi_index_autotune(range_length, range_length, range_length,
+                                    explore, NUMBER_OF_TRIALS, seconds_def,
+                                    seconds_tuned);
+
+      std::cout
+          << label_mdrange << "  Autotuned tile: "
+          << "\n Range length per dim (3D): " << range_length
+          << "\n Default tile time: " << seconds_def
+          << "\n Tuned tile time: " << seconds_tuned
+          << "\n---------------------------------------------------------------"
+          << std::endl;
+    }  // end scope test 1_t
 #endif
 
     // Test 2: RangePolicy Collapse2 style
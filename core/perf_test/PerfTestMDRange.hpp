@@ -42,6 +42,8 @@
 //@HEADER
 */
 
+#include <impl/Kokkos_HostMDRangeTuner.hpp>
+
 namespace Test {
 template <class DeviceType, typename ScalarType = double,
           typename TestLayout = Kokkos::LayoutRight>
@@ -298,6 +300,22 @@ struct MultiDimRangePerf3D {
 
     return dt_min;
   }
+
+  // Compare the default host tile with the tile autotuned over the first
+  // 'explore' launches; the default tile is used for all-zero tile dims
+  static void test_multi_index_autotune(const unsigned int icount,
+                                        const unsigned int jcount,
+                                        const unsigned int kcount,
+                                        const int explore, const long iter,
+                                        double &seconds_default,
+                                        double &seconds_tuned) {
+    seconds_default = test_multi_index(icount, jcount, kcount, 0, 0, 0, iter);
+
+    Kokkos::Impl::HostMDRangeTuner::enable(explore);
+    test_multi_index(icount, jcount, kcount, 0, 0, 0, explore);
+    seconds_tuned = test_multi_index(icount, jcount, kcount, 0, 0, 0, iter);
+    Kokkos::Impl::HostMDRangeTuner::disable();
+  }
 };
 
 template <class DeviceType, typename ScalarType = double,
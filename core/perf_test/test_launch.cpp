@@ -0,0 +1,163 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Timer.hpp>
+
+// Latency of empty kernels on the OpenMP back-end as a function of the
+// number of threads, forking a parallel region per kernel versus
+// dispatching to persistent workers.
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+
+struct EmptyFor {
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int) const {}
+};
+
+struct EmptyReduce {
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int, int&) const {}
+};
+
+// Average microseconds per launch of an empty parallel_for and
+// parallel_reduce with one iteration per thread.
+void measure(const int nthreads, const int repeat, double& for_time,
+             double& reduce_time) {
+  typedef Kokkos::RangePolicy<Kokkos::OpenMP> policy;
+
+  // Warm up
+  for (int i = 0; i < 100; ++i) {
+    Kokkos::parallel_for(policy(0, nthreads), EmptyFor());
+  }
+
+  Kokkos::Impl::Timer timer;
+  for (int i = 0; i < repeat; ++i) {
+    Kokkos::parallel_for(policy(0, nthreads), EmptyFor());
+  }
+  for_time = 1.0e6 * timer.seconds() / repeat;
+
+  int result = 0;
+  timer.reset();
+  for (int i = 0; i < repeat; ++i) {
+    Kokkos::parallel_reduce(policy(0, nthreads), EmptyReduce(), result);
+  }
+  reduce_time = 1.0e6 * timer.seconds() / repeat;
+}
+
+int main(int argc, char* argv[]) {
+  static const char help_flag[]        = "--help";
+  static const char max_threads_flag[] = "--max_threads=";
+  static const char repeat_flag[]      = "--repeat=";
+
+  int max_threads = 0;
+  int repeat      = 10000;
+
+  int ask_help = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char* const a = argv[i];
+
+    if (!strncmp(a, help_flag, strlen(help_flag))) ask_help = 1;
+
+    if (!strncmp(a, max_threads_flag, strlen(max_threads_flag)))
+      max_threads = atoi(a + strlen(max_threads_flag));
+
+    if (!strncmp(a, repeat_flag, strlen(repeat_flag)))
+      repeat = atoi(a + strlen(repeat_flag));
+  }
+
+  if (ask_help) {
+    std::cout << "command line options:"
+              << " " << help_flag << " " << max_threads_flag << "##"
+              << " " << repeat_flag << "##" << std::endl;
+    return 0;
+  }
+
+  if (max_threads < 1) max_threads = omp_get_max_threads();
+
+  printf(
+      "\"launch: threads, for, for persistent, reduce, reduce persistent "
+      "(usec)\"\n");
+
+  for (int nthreads = 1;; nthreads *= 2) {
+    if (max_threads < nthreads) nthreads = max_threads;
+
+    Kokkos::InitArguments args;
+    args.num_threads      = nthreads;
+    args.disable_warnings = true;
+    Kokkos::initialize(args);
+
+    double for_fork, reduce_fork, for_persistent, reduce_persistent;
+
+    measure(nthreads, repeat, for_fork, reduce_fork);
+
+    Kokkos::Impl::t_openmp_instance->start_persistent();
+
+    measure(nthreads, repeat, for_persistent, reduce_persistent);
+
+    Kokkos::finalize();
+
+    printf("\"launch:\" %d %.3f %.3f %.3f %.3f\n", nthreads, for_fork,
+           for_persistent, reduce_fork, reduce_persistent);
+
+    if (max_threads <= nthreads) break;
+  }
+
+  return 0;
+}
+
+#else
+
+int main() {
+  printf("\"launch:\" requires the OpenMP back-end\n");
+  return 0;
+}
+
+#endif
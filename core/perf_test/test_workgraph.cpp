@@ -0,0 +1,259 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Timer.hpp>
+
+// Time to execute a WorkGraphPolicy over wide and deep dependency graphs
+// as a function of the number of threads, with the per-thread ready
+// queues of parallel_for versus every thread popping the policy's
+// shared ready queue.
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+
+typedef Kokkos::WorkGraphPolicy<std::int32_t, Kokkos::OpenMP> policy_type;
+typedef policy_type::graph_type graph_type;
+typedef Kokkos::View<std::int32_t*, Kokkos::OpenMP> flags_type;
+
+// 'levels' levels of 'width' work items, item i of a level depends on
+// items i and i+1 (modulo width) of the previous level.
+graph_type form_graph(const int width, const int levels) {
+  const int n = width * levels;
+
+  graph_type graph;
+
+  graph.row_map = graph_type::row_map_type("row_map", n + 1);
+  graph.entries =
+      graph_type::entries_type("entries", 2 * width * (levels - 1));
+
+  graph_type::row_map_type::HostMirror row_map =
+      Kokkos::create_mirror_view(graph.row_map);
+  graph_type::entries_type::HostMirror entries =
+      Kokkos::create_mirror_view(graph.entries);
+
+  row_map(0) = 0;
+  for (int l = 0, k = 0; l < levels; ++l) {
+    for (int i = 0; i < width; ++i) {
+      if (l + 1 < levels) {
+        entries(k++) = (l + 1) * width + i;
+        entries(k++) = (l + 1) * width + (i + width - 1) % width;
+      }
+      row_map(l * width + i + 1) = k;
+    }
+  }
+
+  Kokkos::deep_copy(graph.row_map, row_map);
+  Kokkos::deep_copy(graph.entries, entries);
+
+  return graph;
+}
+
+struct WorkItem {
+  int width;
+  int work;
+  flags_type done;
+  flags_type errors;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const std::int32_t w) const {
+    if (width <= w) {
+      const int l = w / width;
+      const int i = w % width;
+      if (!done((l - 1) * width + i) ||
+          !done((l - 1) * width + (i + 1) % width)) {
+        Kokkos::atomic_increment(&errors(0));
+      }
+    }
+
+    double x = w;
+    for (int k = 0; k < work; ++k) x = x * 0.999 + 1.0;
+
+    done(w) = 0.0 < x ? 1 : 2;
+  }
+};
+
+// Average microseconds per execution of the graph.
+double measure(const graph_type& graph, const WorkItem& item,
+               const bool shared, const int nthreads, const int repeat) {
+  double time = 0;
+
+  for (int r = 0; r < repeat; ++r) {
+    Kokkos::deep_copy(item.done, 0);
+
+    // Constructing the policy sets up the ready queue, not timed.
+    const policy_type policy(graph);
+
+    Kokkos::Impl::Timer timer;
+
+    if (shared) {
+#pragma omp parallel num_threads(nthreads)
+      {
+        for (std::int32_t w = policy_type::END_TOKEN;
+             policy_type::COMPLETED_TOKEN != (w = policy.pop_work());) {
+          if (policy_type::END_TOKEN != w) {
+            item(w);
+            policy.completed_work(w);
+          }
+        }
+      }
+    } else {
+      Kokkos::parallel_for(policy, item);
+    }
+
+    Kokkos::fence();
+
+    time += timer.seconds();
+  }
+
+  return 1.0e6 * time / repeat;
+}
+
+int main(int argc, char* argv[]) {
+  static const char help_flag[]        = "--help";
+  static const char max_threads_flag[] = "--max_threads=";
+  static const char size_flag[]        = "--size=";
+  static const char work_flag[]        = "--work=";
+  static const char repeat_flag[]      = "--repeat=";
+
+  int max_threads = 0;
+  int size        = 1 << 16;
+  int work        = 100;
+  int repeat      = 10;
+
+  int ask_help = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char* const a = argv[i];
+
+    if (!strncmp(a, help_flag, strlen(help_flag))) ask_help = 1;
+
+    if (!strncmp(a, max_threads_flag, strlen(max_threads_flag)))
+      max_threads = atoi(a + strlen(max_threads_flag));
+
+    if (!strncmp(a, size_flag, strlen(size_flag)))
+      size = atoi(a + strlen(size_flag));
+
+    if (!strncmp(a, work_flag, strlen(work_flag)))
+      work = atoi(a + strlen(work_flag));
+
+    if (!strncmp(a, repeat_flag, strlen(repeat_flag)))
+      repeat = atoi(a + strlen(repeat_flag));
+  }
+
+  if (ask_help) {
+    std::cout << "command line options:"
+              << " " << help_flag << " " << max_threads_flag << "##"
+              << " " << size_flag << "##"
+              << " " << work_flag << "##"
+              << " " << repeat_flag << "##" << std::endl;
+    return 0;
+  }
+
+  if (max_threads < 1) max_threads = omp_get_max_threads();
+
+  // Wide: few levels of many independent items,
+  // deep: many levels of a few items, as in a triangular solve.
+  const int shapes[2][2] = {{size / 8, 8}, {8, size / 8}};
+
+  printf(
+      "\"workgraph: threads, width, levels, shared queue, "
+      "thread queues (usec)\"\n");
+
+  int errors = 0;
+
+  for (int nthreads = 1;; nthreads *= 2) {
+    if (max_threads < nthreads) nthreads = max_threads;
+
+    Kokkos::InitArguments args;
+    args.num_threads      = nthreads;
+    args.disable_warnings = true;
+    Kokkos::initialize(args);
+
+    for (int s = 0; s < 2; ++s) {
+      const graph_type graph = form_graph(shapes[s][0], shapes[s][1]);
+
+      WorkItem item;
+      item.width  = shapes[s][0];
+      item.work   = work;
+      item.done   = flags_type("done", graph.numRows());
+      item.errors = flags_type("errors", 1);
+
+      const double shared = measure(graph, item, true, nthreads, repeat);
+      const double local  = measure(graph, item, false, nthreads, repeat);
+
+      flags_type::HostMirror h_errors = Kokkos::create_mirror_view(item.errors);
+      Kokkos::deep_copy(h_errors, item.errors);
+      errors += h_errors(0);
+
+      printf("\"workgraph:\" %d %d %d %.1f %.1f\n", nthreads, shapes[s][0],
+             shapes[s][1], shared, local);
+    }
+
+    Kokkos::finalize();
+
+    if (max_threads <= nthreads) break;
+  }
+
+  if (errors) {
+    printf("\"workgraph:\" %d work items ran before their dependences\n",
+           errors);
+  }
+
+  return errors ? 1 : 0;
+}
+
+#else
+
+int main() {
+  printf("\"workgraph:\" requires the OpenMP back-end\n");
+  return 0;
+}
+
+#endif
@@ -449,7 +449,8 @@ void CudaInternal::initialize(int cuda_device_id, cudaStream_t stream) {
       m_maxConcurrency = m_maxThreadsPerSM * cudaProp.multiProcessorCount;
 
       const int32_t buffer_bound =
-          Kokkos::Impl::concurrent_bitset::buffer_bound(m_maxConcurrency);
+          Kokkos::Impl::concurrent_bitset::summary_buffer_bound(
+              m_maxConcurrency);
 
       // Allocate and initialize uint32_t[ buffer_bound ]
 
@@ -96,7 +96,7 @@ class UniqueToken<Cuda, UniqueTokenScope::Global> {
   KOKKOS_INLINE_FUNCTION
   size_type acquire() const {
     const Kokkos::pair<int, int> result =
-        Kokkos::Impl::concurrent_bitset::acquire_bounded(
+        Kokkos::Impl::concurrent_bitset::acquire_summary_bounded(
             m_buffer, m_count, Kokkos::Impl::clock_tic() % m_count);
 
     if (result.first < 0) {
@@ -110,7 +110,7 @@ class UniqueToken<Cuda, UniqueTokenScope::Global> {
   /// \brief release an acquired value
   KOKKOS_INLINE_FUNCTION
   void release(size_type i) const noexcept {
-    Kokkos::Impl::concurrent_bitset::release(m_buffer, i);
+    Kokkos::Impl::concurrent_bitset::release_summary(m_buffer, m_count, i);
   }
 };
 
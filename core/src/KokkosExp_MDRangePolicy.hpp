@@ -102,16 +102,67 @@ struct default_inner_direction {
 #endif
 };
 
+// Compile-time tile dimensions of an iteration pattern, e.g.
+//   Rank<3, Iterate::Right, Iterate::Right, TileSize<4, 8, 64> >
+// Full tiles of a compile-time size have constant loop trip counts on host.
+template <unsigned... Dims>
+struct TileSize;
+
+template <>
+struct TileSize<> {
+  enum { rank = 0 };
+
+  KOKKOS_INLINE_FUNCTION static constexpr long extent(int) { return 0; }
+  KOKKOS_INLINE_FUNCTION constexpr long operator[](int i) const {
+    return extent(i);
+  }
+};
+
+template <unsigned D0, unsigned... Dims>
+struct TileSize<D0, Dims...> {
+  static_assert(D0 != 0u, "Kokkos Error: tile dimensions must be positive");
+
+  enum { rank = 1 + sizeof...(Dims) };
+
+  KOKKOS_INLINE_FUNCTION static constexpr long extent(int i) {
+    return i == 0 ? long(D0) : TileSize<Dims...>::extent(i - 1);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr long operator[](int i) const {
+    return extent(i);
+  }
+};
+
 // Iteration Pattern
 template <unsigned N, Iterate OuterDir = Iterate::Default,
-          Iterate InnerDir = Iterate::Default>
+          Iterate InnerDir = Iterate::Default, class Tile = void>
 struct Rank {
   static_assert(N != 0u, "Kokkos Error: rank 0 undefined");
   static_assert(N != 1u,
                 "Kokkos Error: rank 1 is not a multi-dimensional range");
   static_assert(N < 7u, "Kokkos Error: Unsupported rank...");
+  static_assert(InnerDir != Iterate::Morton && InnerDir != Iterate::Hilbert,
+                "Kokkos Error: space-filling curves only order tiles");
+  static_assert(std::is_same<Tile, void>::value,
+                "Kokkos Error: Rank tile must be a TileSize");
 
-  using iteration_pattern = Rank<N, OuterDir, InnerDir>;
+  using iteration_pattern = Rank<N, OuterDir, InnerDir, Tile>;
+  using tile_size         = Tile;
+
+  static constexpr int rank                = N;
+  static constexpr Iterate outer_direction = OuterDir;
+  static constexpr Iterate inner_direction = InnerDir;
+};
+
+template <unsigned N, Iterate OuterDir, Iterate InnerDir, unsigned... Dims>
+struct Rank<N, OuterDir, InnerDir, TileSize<Dims...> > {
+  static_assert(N == sizeof...(Dims),
+                "Kokkos Error: TileSize rank does not match Rank");
+  static_assert(N < 7u, "Kokkos Error: Unsupported rank...");
+  static_assert(InnerDir != Iterate::Morton && InnerDir != Iterate::Hilbert,
+                "Kokkos Error: space-filling curves only order tiles");
+
+  using iteration_pattern = Rank<N, OuterDir, InnerDir, TileSize<Dims...> >;
+  using tile_size         = TileSize<Dims...>;
 
   static constexpr int rank                = N;
   static constexpr Iterate outer_direction = OuterDir;
@@ -167,6 +218,7 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   point_type m_tile_end;
   index_type m_num_tiles;
   index_type m_prod_tile_dims;
+  bool m_tune_tiles;  // host tile dimensions were all defaulted
 
   /*
     // NDE enum impl definition alternative - replace static constexpr int ?
@@ -196,8 +248,10 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
           : default_inner_direction<typename traits::execution_space>::value);
 
   // Ugly ugly workaround intel 14 not handling scoped enum correctly
-  static constexpr int Right = static_cast<int>(Iterate::Right);
-  static constexpr int Left  = static_cast<int>(Iterate::Left);
+  static constexpr int Right   = static_cast<int>(Iterate::Right);
+  static constexpr int Left    = static_cast<int>(Iterate::Left);
+  static constexpr int Morton  = static_cast<int>(Iterate::Morton);
+  static constexpr int Hilbert = static_cast<int>(Iterate::Hilbert);
 
   KOKKOS_INLINE_FUNCTION const typename traits::execution_space& space() const {
     return m_space;
@@ -226,7 +280,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_upper(upper),
         m_tile(tile),
         m_num_tiles(1),
-        m_prod_tile_dims(1) {
+        m_prod_tile_dims(1),
+        m_tune_tiles(false) {
     init();
   }
 
@@ -238,7 +293,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_upper(upper),
         m_tile(tile),
         m_num_tiles(1),
-        m_prod_tile_dims(1) {
+        m_prod_tile_dims(1),
+        m_tune_tiles(false) {
     init();
   }
 
@@ -250,10 +306,25 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_tile(p.m_tile),
         m_tile_end(p.m_tile_end),
         m_num_tiles(p.m_num_tiles),
-        m_prod_tile_dims(p.m_prod_tile_dims) {}
+        m_prod_tile_dims(p.m_prod_tile_dims),
+        m_tune_tiles(p.m_tune_tiles) {}
 
  private:
+  // A compile-time TileSize of the iteration pattern overrides any runtime
+  // tile so that the host full-tile loops and the tile offsets agree.
+  void init_static_tile(std::false_type) {}
+
+  void init_static_tile(std::true_type) {
+    for (int i = 0; i < rank; ++i) {
+      m_tile[i] = iteration_pattern::tile_size::extent(i);
+    }
+  }
+
   void init() {
+    init_static_tile(std::integral_constant<
+                     bool, !std::is_same<typename iteration_pattern::tile_size,
+                                         void>::value>());
+
     // Host
     if (true
 #if defined(KOKKOS_ENABLE_CUDA)
@@ -269,8 +340,10 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
 #endif
     ) {
       index_type span;
+      m_tune_tiles = true;
       for (int i = 0; i < rank; ++i) {
         span = m_upper[i] - m_lower[i];
+        if (0 < m_tile[i]) m_tune_tiles = false;
         if (m_tile[i] <= 0) {
           if (((int)inner_direction == (int)Right && (i < rank - 1)) ||
               ((int)inner_direction == (int)Left && (i > 0))) {
@@ -406,8 +479,13 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_tile[i] = 0;
     }
 
+    init_static_tile(std::integral_constant<
+                     bool, !std::is_same<typename iteration_pattern::tile_size,
+                                         void>::value>());
+
     m_num_tiles      = 1;
     m_prod_tile_dims = 1;
+    m_tune_tiles     = false;
 
     // Host
     if (true
@@ -424,8 +502,10 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
 #endif
     ) {
       index_type span;
+      m_tune_tiles = true;
       for (int i = 0; i < rank; ++i) {
         span = m_upper[i] - m_lower[i];
+        if (0 < m_tile[i]) m_tune_tiles = false;
         if (m_tile[i] <= 0) {
           if (((int)inner_direction == (int)Right && (i < rank - 1)) ||
               ((int)inner_direction == (int)Left && (i > 0))) {
@@ -58,12 +58,22 @@ namespace Kokkos {
 // Schedules for Execution Policies
 struct Static {};
 struct Dynamic {};
+// Chunks shrink in proportion to the remaining work (host backends)
+struct Guided {};
+// Guided, with the minimum chunk size tuned across launches of the same
+// kernel from measured load imbalance (host backends).
+// The tuned state is static per template instantiation of the kernel,
+// i.e. per functor and policy type, not per kernel label: launches of the
+// same functor type with different labels or ranges share one state.
+struct Adaptive {};
 
 // Schedule Wrapper Type
 template <class T>
 struct Schedule {
   static_assert(std::is_same<T, Static>::value ||
-                    std::is_same<T, Dynamic>::value,
+                    std::is_same<T, Dynamic>::value ||
+                    std::is_same<T, Guided>::value ||
+                    std::is_same<T, Adaptive>::value,
                 "Kokkos: Invalid Schedule<> type.");
   using schedule_type = Schedule;
   using type          = T;
@@ -88,6 +88,7 @@
 #include <Kokkos_Array.hpp>
 #include <Kokkos_View.hpp>
 #include <Kokkos_Vectorization.hpp>
+#include <Kokkos_SIMD.hpp>
 #include <Kokkos_Atomic.hpp>
 #include <Kokkos_hwloc.hpp>
 #include <Kokkos_Timer.hpp>
@@ -255,6 +256,7 @@ class ScopeGuard {
 
 #include <Kokkos_Crs.hpp>
 #include <Kokkos_WorkGraphPolicy.hpp>
+#include <Kokkos_FusedFor.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
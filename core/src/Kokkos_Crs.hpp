@@ -147,6 +147,10 @@ template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
 void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
                    Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in);
 
+template <class CrsType, class RowsType, class ColsType>
+void coo_to_crs(CrsType& out, typename CrsType::size_type nrows,
+                RowsType const& rows, ColsType const& cols);
+
 }  // namespace Kokkos
 
 /*--------------------------------------------------------------------------*/
@@ -263,6 +267,258 @@ class FillCrsTransposeEntries {
   }
 };
 
+/* Scattering items into buckets (rows) is done without atomics on host
+ * execution spaces: the items are split into chunks, one per thread, with
+ * private counters for every bucket, laid out bucket major so that the
+ * scan of the counters gives every chunk its own offset in every bucket.
+ * This keeps the items of a bucket in input order.  Returns the number
+ * of chunks, or zero if the counters would be too many and atomics on
+ * shared counters are used instead.
+ */
+template <class ExecutionSpace>
+size_t crs_bucket_chunks(const size_t nbuckets, const size_t nitems) {
+  if (!std::is_same<typename ExecutionSpace::memory_space,
+                    Kokkos::HostSpace>::value) {
+    return 0;
+  }
+  const size_t nchunks = ExecutionSpace::concurrency();
+  return nchunks * nbuckets <= 8 * (nbuckets + nitems) ? nchunks : 0;
+}
+
+template <class InCrs, class OutCrs>
+class FillCrsTransposeBuckets {
+ public:
+  using execution_space = typename InCrs::execution_space;
+  using memory_space    = typename InCrs::memory_space;
+  using index_type      = typename InCrs::size_type;
+  using counters_type   = View<index_type*, memory_space>;
+  struct Count {};
+  struct RowMap {};
+  struct Fill {};
+
+ private:
+  InCrs in;
+  OutCrs out;
+  counters_type counters;
+  size_t nchunks;
+
+  KOKKOS_INLINE_FUNCTION
+  index_type chunk_begin(const size_t c) const {
+    return index_type((size_t(in.numRows()) * c) / nchunks);
+  }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Count, index_type c) const {
+    for (index_type i = chunk_begin(c); i < chunk_begin(c + 1); ++i) {
+      for (auto j = in.row_map(i); j < in.row_map(i + 1); ++j) {
+        ++counters(size_t(in.entries(j)) * nchunks + c);
+      }
+    }
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator()(RowMap, index_type t) const {
+    out.row_map(t) = counters(size_t(t) * nchunks);
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Fill, index_type c) const {
+    for (index_type i = chunk_begin(c); i < chunk_begin(c + 1); ++i) {
+      for (auto j = in.row_map(i); j < in.row_map(i + 1); ++j) {
+        const size_t b             = size_t(in.entries(j)) * nchunks + c;
+        out.entries(counters(b)++) = i;
+      }
+    }
+  }
+  using self_type = FillCrsTransposeBuckets<InCrs, OutCrs>;
+  template <class Tag>
+  void run(const index_type n) const {
+    using policy_type  = RangePolicy<index_type, execution_space, Tag>;
+    using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+    const closure_type closure(*this, policy_type(0, n));
+    closure.execute();
+    execution_space().fence();
+  }
+  FillCrsTransposeBuckets(InCrs const& arg_in, OutCrs& arg_out,
+                          const size_t arg_nchunks)
+      : in(arg_in),
+        out(arg_out),
+        counters("transpose_counters", arg_in.numRows() * arg_nchunks),
+        nchunks(arg_nchunks) {
+    run<Count>(index_type(nchunks));
+    {
+      counters_type offsets;
+      get_crs_row_map_from_counts(offsets, counters, "transpose_offsets");
+      counters = offsets;
+    }
+    out.row_map = decltype(out.row_map)(
+        ViewAllocateWithoutInitializing("tranpose_row_map"),
+        in.numRows() + 1);
+    run<RowMap>(in.numRows() + 1);
+    out.entries =
+        decltype(out.entries)("transpose_entries", in.entries.size());
+    run<Fill>(index_type(nchunks));
+    arg_out = out;
+  }
+};
+
+/* Sort the 'n' values at 'v' in place: insertion sort for short rows,
+ * heap sort otherwise.
+ */
+template <class ValueType>
+KOKKOS_INLINE_FUNCTION void crs_sort_row(ValueType* const v, const size_t n) {
+  if (n <= 16) {
+    for (size_t i = 1; i < n; ++i) {
+      const ValueType x = v[i];
+      size_t j          = i;
+      for (; 0 < j && x < v[j - 1]; --j) v[j] = v[j - 1];
+      v[j] = x;
+    }
+    return;
+  }
+  for (size_t end = n, k = n / 2; 1 < end;) {
+    size_t i;
+    if (0 < k) {
+      i = --k;  // build the heap
+    } else {
+      const ValueType x = v[--end];  // move the largest past the heap
+      v[end]            = v[0];
+      v[0]              = x;
+      i                 = 0;
+    }
+    for (size_t c = 2 * i + 1; c < end; i = c, c = 2 * i + 1) {
+      if (c + 1 < end && v[c] < v[c + 1]) ++c;
+      if (!(v[i] < v[c])) break;
+      const ValueType x = v[i];
+      v[i]              = v[c];
+      v[c]              = x;
+    }
+  }
+}
+
+/* Build the row map and the sorted, deduplicated entries of a compressed
+ * row storage graph from unsorted coordinate (row, col) pairs:
+ * histogram of the rows, scan, scatter of the columns, then sort and
+ * deduplicate every row and compact.
+ */
+template <class RowMap, class Entries, class Rows, class Cols>
+class CrsFromCoo {
+ public:
+  using execution_space = typename Entries::execution_space;
+  using memory_space    = typename Entries::memory_space;
+  using size_type       = typename RowMap::non_const_value_type;
+  using data_type       = typename Entries::non_const_value_type;
+  using counters_type   = View<size_type*, memory_space>;
+  using work_type       = View<data_type*, memory_space>;
+  struct Count {};
+  struct RowStart {};
+  struct Fill {};
+  struct Sort {};
+  struct Compact {};
+
+ private:
+  Rows m_rows;
+  Cols m_cols;
+  size_t m_nchunks;  // zero if the shared row counters are atomic
+  counters_type m_counters;
+  counters_type m_start;
+  work_type m_work;
+  RowMap m_row_map;
+  Entries m_entries;
+
+  KOKKOS_INLINE_FUNCTION
+  size_t chunk_begin(const size_t c) const {
+    return (m_rows.extent(0) * c) / m_nchunks;
+  }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Count, size_type i) const {
+    if (m_nchunks) {
+      for (size_t j = chunk_begin(i); j < chunk_begin(i + 1); ++j) {
+        ++m_counters(size_t(m_rows(j)) * m_nchunks + i);
+      }
+    } else {
+      atomic_increment(&m_counters(m_rows(i)));
+    }
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator()(RowStart, size_type r) const {
+    m_start(r) = m_counters(m_nchunks ? size_t(r) * m_nchunks : size_t(r));
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Fill, size_type i) const {
+    if (m_nchunks) {
+      for (size_t j = chunk_begin(i); j < chunk_begin(i + 1); ++j) {
+        const size_t b          = size_t(m_rows(j)) * m_nchunks + i;
+        m_work(m_counters(b)++) = m_cols(j);
+      }
+    } else {
+      m_work(atomic_fetch_add(&m_counters(m_rows(i)), size_type(1))) =
+          m_cols(i);
+    }
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Sort, size_type r) const {
+    const size_type begin = m_start(r);
+    const size_type n     = m_start(r + 1) - begin;
+    data_type* const v    = m_work.data() + begin;
+    crs_sort_row(v, n);
+    size_type unique = 0 < n ? 1 : 0;
+    for (size_type j = 1; j < n; ++j) {
+      if (v[j - 1] < v[j]) ++unique;
+    }
+    m_counters(r) = unique;
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Compact, size_type r) const {
+    const size_type begin = m_start(r);
+    const size_type end   = m_start(r + 1);
+    size_type k           = m_row_map(r);
+    for (size_type j = begin; j < end; ++j) {
+      if (j == begin || m_work(j - 1) < m_work(j)) m_entries(k++) = m_work(j);
+    }
+  }
+  using self_type = CrsFromCoo<RowMap, Entries, Rows, Cols>;
+  template <class Tag>
+  void run(const size_t n) const {
+    using policy_type  = RangePolicy<size_type, execution_space, Tag>;
+    using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+    const closure_type closure(*this, policy_type(0, size_type(n)));
+    closure.execute();
+    execution_space().fence();
+  }
+  CrsFromCoo(RowMap& row_map, Entries& entries, std::string const& label,
+             const size_t nrows, Rows const& rows, Cols const& cols)
+      : m_rows(rows),
+        m_cols(cols),
+        m_nchunks(crs_bucket_chunks<execution_space>(nrows, rows.extent(0))) {
+    const size_t nitems = rows.extent(0);
+    m_counters =
+        counters_type("coo_counters", m_nchunks ? nrows * m_nchunks : nrows);
+    run<Count>(m_nchunks ? m_nchunks : nitems);
+    {
+      counters_type offsets;
+      get_crs_row_map_from_counts(offsets, m_counters, "coo_offsets");
+      m_counters = offsets;
+    }
+    m_start = counters_type(ViewAllocateWithoutInitializing("coo_start"),
+                            nrows + 1);
+    run<RowStart>(nrows + 1);
+    m_work = work_type(ViewAllocateWithoutInitializing("coo_work"), nitems);
+    run<Fill>(m_nchunks ? m_nchunks : nitems);
+    m_counters = counters_type(ViewAllocateWithoutInitializing("coo_unique"),
+                               nrows);
+    run<Sort>(nrows);
+    const size_type nentries =
+        get_crs_row_map_from_counts(m_row_map, m_counters, "row_map");
+    m_counters = counters_type();
+    m_entries  = Entries(label, nentries);
+    run<Compact>(nrows);
+    row_map = m_row_map;
+    entries = m_entries;
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -296,6 +552,14 @@ void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
   typedef Crs<DataType, Arg1Type, Arg2Type, SizeType> crs_type;
   typedef typename crs_type::memory_space memory_space;
   typedef View<SizeType*, memory_space> counts_type;
+  typedef typename crs_type::execution_space execution_space;
+  const size_t nchunks = Kokkos::Impl::crs_bucket_chunks<execution_space>(
+      in.numRows(), in.entries.size());
+  if (0 < nchunks) {
+    Kokkos::Impl::FillCrsTransposeBuckets<crs_type, crs_type> functor(
+        in, out, nchunks);
+    return;
+  }
   {
     counts_type counts;
     Kokkos::get_crs_transpose_counts(counts, in);
@@ -307,6 +571,25 @@ void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
       in, out);
 }
 
+/** \brief  Build 'out' from the unsorted coordinate pairs
+ *          (rows(i), cols(i)), with 0 <= rows(i) < nrows.
+ *
+ *  The entries of every row are sorted and duplicates are removed.
+ */
+template <class CrsType, class RowsType, class ColsType>
+void coo_to_crs(CrsType& out, typename CrsType::size_type nrows,
+                RowsType const& rows, ColsType const& cols) {
+  static_assert(RowsType::rank == 1 && ColsType::rank == 1,
+                "Kokkos::coo_to_crs requires rank one row and column Views");
+  if (rows.extent(0) != cols.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::coo_to_crs row and column Views differ in length");
+  }
+  Kokkos::Impl::CrsFromCoo<typename CrsType::row_map_type,
+                           typename CrsType::entries_type, RowsType, ColsType>
+      functor(out.row_map, out.entries, "entries", nrows, rows, cols);
+}
+
 template <class CrsType, class Functor,
           class ExecutionSpace = typename CrsType::execution_space>
 struct CountAndFillBase;
@@ -0,0 +1,283 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_FUSEDFOR_HPP
+#define KOKKOS_FUSEDFOR_HPP
+
+#include <Kokkos_Parallel.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Marker separating dependent stages of a fused_for.
+///
+/// Stages between two barriers may only depend on results that earlier
+/// stages produced for the same index.  A stage that reads another index
+/// of an earlier stage's output must be preceded by a FusedBarrier.
+struct FusedBarrier {};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+/// \brief Ordered list of fused_for stages.
+///
+/// Stored as a recursive head/tail pair rather than std::tuple so that it
+/// can be copied into and called from device closures.
+template <class... Stages>
+struct FusedStages;
+
+template <>
+struct FusedStages<> {
+  template <class TagType, class Member>
+  KOKKOS_INLINE_FUNCTION void exec_segment(const Member) const {}
+};
+
+template <class Stage, class... Stages>
+struct FusedStages<Stage, Stages...> {
+  Stage m_head;
+  FusedStages<Stages...> m_tail;
+
+  FusedStages(const Stage& arg_head, const Stages&... arg_tail)
+      : m_head(arg_head), m_tail(arg_tail...) {}
+
+  /// Apply every stage up to the next barrier at index i.
+  template <class TagType, class Member>
+  KOKKOS_INLINE_FUNCTION typename std::enable_if<
+      std::is_same<TagType, void>::value>::type
+  exec_segment(const Member i) const {
+    m_head(i);
+    m_tail.template exec_segment<TagType>(i);
+  }
+
+  template <class TagType, class Member>
+  KOKKOS_INLINE_FUNCTION typename std::enable_if<
+      !std::is_same<TagType, void>::value>::type
+  exec_segment(const Member i) const {
+    const TagType t{};
+    m_head(t, i);
+    m_tail.template exec_segment<TagType>(i);
+  }
+};
+
+template <class... Stages>
+struct FusedStages<Kokkos::Experimental::FusedBarrier, Stages...> {
+  Kokkos::Experimental::FusedBarrier m_head;
+  FusedStages<Stages...> m_tail;
+
+  FusedStages(const Kokkos::Experimental::FusedBarrier& arg_head,
+              const Stages&... arg_tail)
+      : m_head(arg_head), m_tail(arg_tail...) {}
+
+  template <class TagType, class Member>
+  KOKKOS_INLINE_FUNCTION void exec_segment(const Member) const {}
+};
+
+/// \brief The stages following the first barrier of a FusedStages list.
+template <class List>
+struct FusedNextSegment;
+
+template <>
+struct FusedNextSegment<FusedStages<> > {
+  typedef FusedStages<> type;
+  static const type& get(const FusedStages<>& s) { return s; }
+};
+
+template <class... Stages>
+struct FusedNextSegment<
+    FusedStages<Kokkos::Experimental::FusedBarrier, Stages...> > {
+  typedef FusedStages<Stages...> type;
+  static const type& get(
+      const FusedStages<Kokkos::Experimental::FusedBarrier, Stages...>& s) {
+    return s.m_tail;
+  }
+};
+
+template <class Stage, class... Stages>
+struct FusedNextSegment<FusedStages<Stage, Stages...> > {
+  typedef FusedNextSegment<FusedStages<Stages...> > next;
+  typedef typename next::type type;
+  static const type& get(const FusedStages<Stage, Stages...>& s) {
+    return next::get(s.m_tail);
+  }
+};
+
+/// \brief Functor applying one barrier-free segment of stages pointwise.
+template <class List, class WorkTag>
+struct FusedSegment {
+  List m_stages;
+
+  template <class Member>
+  KOKKOS_INLINE_FUNCTION void operator()(const Member i) const {
+    m_stages.template exec_segment<WorkTag>(i);
+  }
+
+  template <class TagType, class Member>
+  KOKKOS_INLINE_FUNCTION void operator()(const TagType&,
+                                         const Member i) const {
+    m_stages.template exec_segment<WorkTag>(i);
+  }
+};
+
+/// \brief Implementation of fused_for.
+///
+/// The generic version launches one parallel_for per barrier-free segment,
+/// applying the stages of the segment one after another at each index.
+/// Back-ends with a cheaper way to synchronize their threads specialize
+/// this class to run all segments within one parallel region.
+template <class List, class Policy,
+          class ExecSpace = typename Policy::execution_space>
+class FusedFor {
+ private:
+  typedef typename Policy::work_tag WorkTag;
+
+  const List m_stages;
+  const Policy m_policy;
+
+  template <class Stages>
+  static void launch(const Policy&, const Stages&, std::true_type) {}
+
+  template <class Stages>
+  static void launch(const Policy& policy, const Stages& stages,
+                     std::false_type) {
+    typedef FusedSegment<Stages, WorkTag> segment_type;
+    typedef FusedNextSegment<Stages> next;
+
+    const segment_type segment = {stages};
+
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    Impl::ParallelFor<segment_type, Policy> closure(segment, policy);
+    Kokkos::Impl::shared_allocation_tracking_enable();
+
+    closure.execute();
+
+    launch(policy, next::get(stages),
+           std::is_same<typename next::type, FusedStages<> >());
+  }
+
+  // Skip leading and repeated barriers rather than launching empty kernels
+  template <class... Stages>
+  static void launch(
+      const Policy& policy,
+      const FusedStages<Kokkos::Experimental::FusedBarrier, Stages...>& stages,
+      std::false_type) {
+    launch(policy, stages.m_tail,
+           std::is_same<FusedStages<Stages...>, FusedStages<> >());
+  }
+
+ public:
+  inline void execute() const {
+    launch(m_policy, m_stages, std::is_same<List, FusedStages<> >());
+  }
+
+  FusedFor(const List& arg_stages, const Policy& arg_policy)
+      : m_stages(arg_stages), m_policy(arg_policy) {}
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Execute a sequence of parallel_for functors over one range.
+ *
+ *  fused_for( policy , f1 , f2 , FusedBarrier() , f3 );
+ *
+ *  is equivalent to calling parallel_for with policy for f1, f2 and f3 in
+ *  turn, except that stages not separated by a FusedBarrier may be applied
+ *  back to back at each index.  Back-ends which support it run all stages
+ *  within a single parallel region using a static partition of the range,
+ *  so the policy's schedule is not honored and barriers are the only
+ *  synchronization between stages.
+ */
+template <class... Traits, class... Stages>
+inline void fused_for(const std::string& str,
+                      const Kokkos::RangePolicy<Traits...>& policy,
+                      const Stages&... stages) {
+  typedef Kokkos::RangePolicy<Traits...> policy_type;
+  typedef Kokkos::Impl::FusedStages<Stages...> stages_type;
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  uint64_t kpID = 0;
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Impl::ParallelConstructName<stages_type,
+                                        typename policy_type::work_tag>
+        name(str);
+    Kokkos::Profiling::beginParallelFor(
+        name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
+        &kpID);
+  }
+#else
+  (void)str;
+#endif
+
+  Kokkos::Impl::shared_allocation_tracking_disable();
+  Kokkos::Impl::FusedFor<stages_type, policy_type> closure(
+      stages_type(stages...), policy);
+  Kokkos::Impl::shared_allocation_tracking_enable();
+
+  closure.execute();
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::endParallelFor(kpID);
+  }
+#endif
+}
+
+template <class... Traits, class... Stages>
+inline void fused_for(const Kokkos::RangePolicy<Traits...>& policy,
+                      const Stages&... stages) {
+  Kokkos::Experimental::fused_for("", policy, stages...);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
+#ifdef KOKKOS_ENABLE_OPENMP
+#include "OpenMP/Kokkos_OpenMP_FusedFor.hpp"
+#endif
+
+#endif /* #define KOKKOS_FUSEDFOR_HPP */
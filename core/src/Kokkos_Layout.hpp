@@ -244,8 +244,10 @@ struct LayoutTileLeft {
 
 enum class Iterate {
   Default,
-  Left,  // Left indices stride fastest
-  Right  // Right indices stride fastest
+  Left,     // Left indices stride fastest
+  Right,    // Right indices stride fastest
+  Morton,   // MDRange tiles ordered along a Z-order curve (host, outer only)
+  Hilbert   // MDRange tiles ordered along a Hilbert curve (host, outer only)
 };
 
 // To check for LayoutTiled
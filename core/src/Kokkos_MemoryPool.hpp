@@ -378,12 +378,13 @@ class MemoryPool {
 
     {
       // Any superblock can be assigned to the smallest size block
-      // Size the block bitset to maximum number of blocks
+      // Size the summarized block bitset to maximum number of blocks
 
       const uint32_t max_block_count_lg2 = m_sb_size_lg2 - m_min_block_size_lg2;
 
       m_sb_state_size =
-          (CB::buffer_bound_lg2(max_block_count_lg2) + int_align_mask) &
+          (CB::summary_buffer_bound(1u << max_block_count_lg2) +
+           int_align_mask) &
           ~int_align_mask;
     }
 
@@ -568,8 +569,14 @@ class MemoryPool {
         const uint32_t count_lg2 = sb_state >> state_shift;
         const uint32_t mask      = (1u << count_lg2) - 1;
 
-        const Kokkos::pair<int, int> result = CB::acquire_bounded_lg2(
-            sb_state_array, count_lg2, block_id_hint & mask, sb_state);
+        // The block bitset is laid out for the smallest block size
+
+        const uint32_t layout_bound =
+            1u << (m_sb_size_lg2 - m_min_block_size_lg2);
+
+        const Kokkos::pair<int, int> result = CB::acquire_summary_bounded(
+            sb_state_array, 1u << count_lg2, block_id_hint & mask, sb_state,
+            layout_bound);
 
         // If result.first < 0 then failed to acquire
         // due to either full or buffer was wrong state.
@@ -770,7 +777,12 @@ class MemoryPool {
         const uint32_t bit =
             (d & (ptrdiff_t(1LU << m_sb_size_lg2) - 1)) >> block_size_lg2;
 
-        const int result = CB::release(sb_state_array, bit, block_state);
+        const uint32_t count_bound  = 1u << (block_state >> state_shift);
+        const uint32_t layout_bound =
+            1u << (m_sb_size_lg2 - m_min_block_size_lg2);
+
+        const int result = CB::release_summary(
+            sb_state_array, count_bound, bit, block_state, layout_bound);
 
         ok_dealloc_once = 0 <= result;
 
@@ -0,0 +1,691 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_SIMD.hpp
+/// \brief Fixed width SIMD value types for explicit vectorization.
+///
+/// Kokkos::Experimental::simd<T, Abi> is a value holding simd::size()
+/// lanes of T in one vector register of the instruction set named by
+/// Abi.  Arithmetic, comparison and math functions apply lane wise and
+/// compile to the corresponding vector instructions, independent of
+/// whether the compiler would have auto-vectorized the surrounding loop.
+///
+/// The instruction sets are those the compiler targets, as selected by
+/// the KOKKOS_ARCH_* options.  simd_abi::scalar is always available,
+/// including in device code.
+
+#ifndef KOKKOS_SIMD_HPP
+#define KOKKOS_SIMD_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Array.hpp>
+#include <Kokkos_Concepts.hpp>
+#include <Kokkos_NumericTraits.hpp>
+#include <Kokkos_View.hpp>
+#include <impl/Kokkos_BitOps.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX512F__)
+#define KOKKOS_IMPL_SIMD_AVX512
+#endif
+
+#if defined(__AVX2__)
+#define KOKKOS_IMPL_SIMD_AVX2
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define KOKKOS_IMPL_SIMD_NEON
+#endif
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace simd_abi {
+
+/// One lane, available for every arithmetic type and execution space.
+struct scalar {};
+
+/// 256 bit AVX2 registers: 4 x double, 8 x float.
+struct avx2 {};
+
+/// 512 bit AVX-512F registers: 8 x double, 16 x float.
+struct avx512 {};
+
+/// 128 bit AArch64 NEON registers: 2 x double, 4 x float.
+struct neon {};
+
+/// The widest ABI enabled for host code in this compilation.
+#if defined(KOKKOS_IMPL_SIMD_AVX512)
+typedef avx512 host_native;
+#elif defined(KOKKOS_IMPL_SIMD_AVX2)
+typedef avx2 host_native;
+#elif defined(KOKKOS_IMPL_SIMD_NEON)
+typedef neon host_native;
+#else
+typedef scalar host_native;
+#endif
+
+}  // namespace simd_abi
+
+/// copy_from / copy_to pointer is aligned to alignof(T).
+struct element_aligned_tag {};
+
+/// copy_from / copy_to pointer is aligned to the full vector width.
+struct vector_aligned_tag {};
+
+template <class T, class Abi>
+class simd;
+
+template <class T, class Abi>
+class simd_mask;
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Vector operations on the native register type of an ABI.
+ *
+ *  Specializations provide the native_type and mask_type registers,
+ *  the lane count 'size', and static functions for memory access,
+ *  arithmetic, comparison, blend, mask logic, horizontal reductions
+ *  and gather / scatter.  simd and simd_mask are thin wrappers.
+ */
+template <class T, class Abi>
+struct simd_impl;
+
+/** \brief  Whether simd_impl< T , Abi > exists in this compilation. */
+template <class T, class Abi>
+struct simd_abi_supports : public std::false_type {};
+
+template <class T>
+struct simd_abi_supports<T, Kokkos::Experimental::simd_abi::scalar>
+    : public std::is_arithmetic<T> {};
+
+#if defined(KOKKOS_IMPL_SIMD_AVX2)
+template <>
+struct simd_abi_supports<double, Kokkos::Experimental::simd_abi::avx2>
+    : public std::true_type {};
+template <>
+struct simd_abi_supports<float, Kokkos::Experimental::simd_abi::avx2>
+    : public std::true_type {};
+#endif
+
+#if defined(KOKKOS_IMPL_SIMD_AVX512)
+template <>
+struct simd_abi_supports<double, Kokkos::Experimental::simd_abi::avx512>
+    : public std::true_type {};
+template <>
+struct simd_abi_supports<float, Kokkos::Experimental::simd_abi::avx512>
+    : public std::true_type {};
+#endif
+
+#if defined(KOKKOS_IMPL_SIMD_NEON)
+template <>
+struct simd_abi_supports<double, Kokkos::Experimental::simd_abi::neon>
+    : public std::true_type {};
+template <>
+struct simd_abi_supports<float, Kokkos::Experimental::simd_abi::neon>
+    : public std::true_type {};
+#endif
+
+/** \brief  Disambiguates construction from a native register, which
+ *          for the scalar ABI has the same type as the broadcast value.
+ */
+struct simd_native_tag {};
+
+/** \brief  Element offsets of the lanes of a rank one View. */
+template <class ViewType, size_t N>
+KOKKOS_FORCEINLINE_FUNCTION Kokkos::Array<std::int32_t, N> simd_view_index(
+    ViewType const& v, Kokkos::Array<std::int32_t, N> const& index) {
+  static_assert(unsigned(ViewType::Rank) == 1u,
+                "Kokkos::Experimental::simd requires a rank one View");
+  Kokkos::Array<std::int32_t, N> offset = index;
+  if (v.stride_0() != 1) {
+    for (size_t k = 0; k < N; ++k) offset[k] *= std::int32_t(v.stride_0());
+  }
+  return offset;
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#include <impl/Kokkos_SIMD_Scalar.hpp>
+#include <impl/Kokkos_SIMD_AVX2.hpp>
+#include <impl/Kokkos_SIMD_AVX512.hpp>
+#include <impl/Kokkos_SIMD_NEON.hpp>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  The widest ABI for T in kernels of ExecSpace.
+ *
+ *  Execution spaces that run on the host use simd_abi::host_native if
+ *  it supports T, everything else falls back to simd_abi::scalar.
+ */
+template <class T, class ExecSpace = Kokkos::DefaultExecutionSpace>
+struct native_simd_abi {
+  typedef typename std::conditional<
+      Kokkos::Impl::SpaceAccessibility<ExecSpace,
+                                       Kokkos::HostSpace>::accessible &&
+          Kokkos::Impl::simd_abi_supports<T, simd_abi::host_native>::value,
+      simd_abi::host_native, simd_abi::scalar>::type type;
+};
+
+/** \brief  Lane mask, the result of comparing two simd values. */
+template <class T, class Abi>
+class simd_mask {
+ private:
+  typedef Kokkos::Impl::simd_impl<T, Abi> impl;
+
+ public:
+  typedef bool value_type;
+  typedef Abi abi_type;
+  typedef simd<T, Abi> simd_type;
+  typedef typename impl::mask_type native_type;
+
+  KOKKOS_INLINE_FUNCTION static constexpr int size() { return impl::size; }
+
+  KOKKOS_DEFAULTED_FUNCTION simd_mask() = default;
+
+  /// Set all lanes to v.
+  KOKKOS_FORCEINLINE_FUNCTION explicit simd_mask(bool const v)
+      : m_value(impl::mask_broadcast(v)) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  simd_mask(native_type const& v, Kokkos::Impl::simd_native_tag)
+      : m_value(v) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION native_type const& native() const {
+    return m_value;
+  }
+
+  /// Lane i of the mask as bit i.
+  KOKKOS_FORCEINLINE_FUNCTION unsigned bits() const {
+    return impl::mask_bits(m_value);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION bool operator[](int const i) const {
+    return (bits() >> i) & 1u;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd_mask operator&&(simd_mask const& a,
+                                                          simd_mask const& b) {
+    return simd_mask(impl::mask_and(a.m_value, b.m_value),
+                     Kokkos::Impl::simd_native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd_mask operator||(simd_mask const& a,
+                                                          simd_mask const& b) {
+    return simd_mask(impl::mask_or(a.m_value, b.m_value),
+                     Kokkos::Impl::simd_native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(impl::mask_not(m_value), Kokkos::Impl::simd_native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend bool operator==(simd_mask const& a,
+                                                     simd_mask const& b) {
+    return a.bits() == b.bits();
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend bool operator!=(simd_mask const& a,
+                                                     simd_mask const& b) {
+    return a.bits() != b.bits();
+  }
+
+ private:
+  native_type m_value;
+};
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool all_of(simd_mask<T, Abi> const& m) {
+  return m.bits() == (~0u >> (32 - simd_mask<T, Abi>::size()));
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool any_of(simd_mask<T, Abi> const& m) {
+  return m.bits() != 0u;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool none_of(simd_mask<T, Abi> const& m) {
+  return m.bits() == 0u;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION int popcount(simd_mask<T, Abi> const& m) {
+  return Kokkos::Impl::bit_count(m.bits());
+}
+
+//----------------------------------------------------------------------------
+
+/** \brief  simd::size() lanes of T in one vector register.
+ *
+ *  Construction from a T broadcasts it to all lanes, so scalars mix
+ *  freely with simd values in arithmetic expressions.  Loads and stores
+ *  are through copy_from / copy_to with an alignment flag; gather_from
+ *  and scatter_to take per lane element indices into a pointer or a
+ *  rank one View.
+ */
+template <class T, class Abi>
+class simd {
+ private:
+  typedef Kokkos::Impl::simd_impl<T, Abi> impl;
+  typedef Kokkos::Impl::simd_native_tag native_tag;
+
+ public:
+  typedef T value_type;
+  typedef Abi abi_type;
+  typedef simd_mask<T, Abi> mask_type;
+  typedef typename impl::native_type native_type;
+  typedef Kokkos::Array<std::int32_t, impl::size> index_type;
+
+  KOKKOS_INLINE_FUNCTION static constexpr int size() { return impl::size; }
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+
+  /// Broadcast v to all lanes.
+  KOKKOS_FORCEINLINE_FUNCTION simd(T const v) : m_value(impl::broadcast(v)) {}
+
+  template <class Flags>
+  KOKKOS_FORCEINLINE_FUNCTION simd(T const* const p, Flags const f) {
+    copy_from(p, f);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd(native_type const& v, native_tag)
+      : m_value(v) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION native_type const& native() const {
+    return m_value;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION T operator[](int const i) const {
+    return impl::get(m_value, i);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(T const* const p,
+                                             element_aligned_tag) {
+    m_value = impl::load(p);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(T const* const p,
+                                             vector_aligned_tag) {
+    m_value = impl::load_aligned(p);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* const p,
+                                           element_aligned_tag) const {
+    impl::store(p, m_value);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* const p,
+                                           vector_aligned_tag) const {
+    impl::store_aligned(p, m_value);
+  }
+
+  /// Lane k = p[ index[k] ]
+  KOKKOS_FORCEINLINE_FUNCTION void gather_from(T const* const p,
+                                               index_type const& index) {
+    m_value = impl::gather(p, index.data());
+  }
+
+  /// Lane k = v( index[k] )
+  template <class ViewType>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<Kokkos::is_view<ViewType>::value>::type
+      gather_from(ViewType const& v, index_type const& index) {
+    static_assert(
+        std::is_same<typename ViewType::non_const_value_type, T>::value,
+        "Kokkos::Experimental::simd::gather_from View value_type mismatch");
+    gather_from(v.data(), Kokkos::Impl::simd_view_index(v, index));
+  }
+
+  /// p[ index[k] ] = lane k, in increasing lane order
+  KOKKOS_FORCEINLINE_FUNCTION void scatter_to(T* const p,
+                                              index_type const& index) const {
+    impl::scatter(p, index.data(), m_value);
+  }
+
+  /// v( index[k] ) = lane k, in increasing lane order
+  template <class ViewType>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<Kokkos::is_view<ViewType>::value>::type
+      scatter_to(ViewType const& v, index_type const& index) const {
+    static_assert(
+        std::is_same<typename ViewType::value_type, T>::value,
+        "Kokkos::Experimental::simd::scatter_to View value_type mismatch");
+    scatter_to(v.data(), Kokkos::Impl::simd_view_index(v, index));
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(impl::neg(m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator+=(simd const& b) {
+    m_value = impl::add(m_value, b.m_value);
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator-=(simd const& b) {
+    m_value = impl::sub(m_value, b.m_value);
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator*=(simd const& b) {
+    m_value = impl::mul(m_value, b.m_value);
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator/=(simd const& b) {
+    m_value = impl::div(m_value, b.m_value);
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator+(simd const& a,
+                                                    simd const& b) {
+    return simd(impl::add(a.m_value, b.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator-(simd const& a,
+                                                    simd const& b) {
+    return simd(impl::sub(a.m_value, b.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator*(simd const& a,
+                                                    simd const& b) {
+    return simd(impl::mul(a.m_value, b.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator/(simd const& a,
+                                                    simd const& b) {
+    return simd(impl::div(a.m_value, b.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator==(simd const& a,
+                                                          simd const& b) {
+    return mask_type(impl::cmp_eq(a.m_value, b.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator!=(simd const& a,
+                                                          simd const& b) {
+    return mask_type(impl::cmp_ne(a.m_value, b.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator<(simd const& a,
+                                                         simd const& b) {
+    return mask_type(impl::cmp_lt(a.m_value, b.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator<=(simd const& a,
+                                                          simd const& b) {
+    return mask_type(impl::cmp_le(a.m_value, b.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator>(simd const& a,
+                                                         simd const& b) {
+    return mask_type(impl::cmp_lt(b.m_value, a.m_value), native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator>=(simd const& a,
+                                                          simd const& b) {
+    return mask_type(impl::cmp_le(b.m_value, a.m_value), native_tag());
+  }
+
+ private:
+  native_type m_value;
+};
+
+/** \brief  Simd value with the native width of ExecSpace. */
+template <class T, class ExecSpace = Kokkos::DefaultExecutionSpace>
+using native_simd = simd<T, typename native_simd_abi<T, ExecSpace>::type>;
+
+template <class T, class ExecSpace = Kokkos::DefaultExecutionSpace>
+using native_simd_mask =
+    simd_mask<T, typename native_simd_abi<T, ExecSpace>::type>;
+
+//----------------------------------------------------------------------------
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> abs(simd<T, Abi> const& a) {
+  return simd<T, Abi>(Kokkos::Impl::simd_impl<T, Abi>::abs(a.native()),
+                      Kokkos::Impl::simd_native_tag());
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> sqrt(simd<T, Abi> const& a) {
+  return simd<T, Abi>(Kokkos::Impl::simd_impl<T, Abi>::sqrt(a.native()),
+                      Kokkos::Impl::simd_native_tag());
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> min(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b) {
+  return simd<T, Abi>(
+      Kokkos::Impl::simd_impl<T, Abi>::min(a.native(), b.native()),
+      Kokkos::Impl::simd_native_tag());
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> max(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b) {
+  return simd<T, Abi>(
+      Kokkos::Impl::simd_impl<T, Abi>::max(a.native(), b.native()),
+      Kokkos::Impl::simd_native_tag());
+}
+
+/// a * b + c, fused where the instruction set has it.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> fma(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b,
+                                             simd<T, Abi> const& c) {
+  return simd<T, Abi>(
+      Kokkos::Impl::simd_impl<T, Abi>::fma(a.native(), b.native(), c.native()),
+      Kokkos::Impl::simd_native_tag());
+}
+
+/// Sum of all lanes.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T reduce(simd<T, Abi> const& a) {
+  return Kokkos::Impl::simd_impl<T, Abi>::reduce_add(a.native());
+}
+
+/// Minimum over all lanes.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T hmin(simd<T, Abi> const& a) {
+  return Kokkos::Impl::simd_impl<T, Abi>::reduce_min(a.native());
+}
+
+/// Maximum over all lanes.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T hmax(simd<T, Abi> const& a) {
+  return Kokkos::Impl::simd_impl<T, Abi>::reduce_max(a.native());
+}
+
+//----------------------------------------------------------------------------
+
+/** \brief  The lanes of a simd value selected by a mask.
+ *
+ *  Returned by where( mask , value ).  Loads, gathers and assignment
+ *  only modify the selected lanes of value; stores and scatters only
+ *  write the selected lanes to memory, so a partial vector at the end
+ *  of an array neither reads nor writes past it.
+ */
+template <class T, class Abi, class V>
+class where_expression {
+ private:
+  typedef Kokkos::Impl::simd_impl<T, Abi> impl;
+  typedef Kokkos::Impl::simd_native_tag native_tag;
+  typedef simd<T, Abi> simd_type;
+  typedef typename simd_type::index_type index_type;
+
+  simd_mask<T, Abi> const& m_mask;
+  V& m_value;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  where_expression(simd_mask<T, Abi> const& m, V& v)
+      : m_mask(m), m_value(v) {}
+
+  template <class Flags>
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(T const* const p, Flags) {
+    m_value = simd_type(
+        impl::mask_load(m_mask.native(), p, m_value.native()), native_tag());
+  }
+
+  template <class Flags>
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* const p, Flags) const {
+    impl::mask_store(m_mask.native(), p, m_value.native());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void gather_from(T const* const p,
+                                               index_type const& index) {
+    m_value = simd_type(impl::mask_gather(m_mask.native(), p, index.data(),
+                                          m_value.native()),
+                        native_tag());
+  }
+
+  template <class ViewType>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<Kokkos::is_view<ViewType>::value>::type
+      gather_from(ViewType const& v, index_type const& index) {
+    static_assert(
+        std::is_same<typename ViewType::non_const_value_type, T>::value,
+        "Kokkos::Experimental::where::gather_from View value_type mismatch");
+    gather_from(v.data(), Kokkos::Impl::simd_view_index(v, index));
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void scatter_to(T* const p,
+                                              index_type const& index) const {
+    impl::mask_scatter(m_mask.native(), p, index.data(), m_value.native());
+  }
+
+  template <class ViewType>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<Kokkos::is_view<ViewType>::value>::type
+      scatter_to(ViewType const& v, index_type const& index) const {
+    static_assert(
+        std::is_same<typename ViewType::value_type, T>::value,
+        "Kokkos::Experimental::where::scatter_to View value_type mismatch");
+    scatter_to(v.data(), Kokkos::Impl::simd_view_index(v, index));
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator=(simd_type const& x) {
+    m_value = simd_type(
+        impl::blend(m_mask.native(), x.native(), m_value.native()),
+        native_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator+=(simd_type const& x) {
+    *this = m_value + x;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator-=(simd_type const& x) {
+    *this = m_value - x;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator*=(simd_type const& x) {
+    *this = m_value * x;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator/=(simd_type const& x) {
+    *this = m_value / x;
+  }
+
+  /// Selected lanes of the value, the others replaced by x.
+  KOKKOS_FORCEINLINE_FUNCTION simd_type blend(simd_type const& x) const {
+    return simd_type(
+        impl::blend(m_mask.native(), m_value.native(), x.native()),
+        native_tag());
+  }
+};
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION where_expression<T, Abi, simd<T, Abi> > where(
+    simd_mask<T, Abi> const& m, simd<T, Abi>& v) {
+  return where_expression<T, Abi, simd<T, Abi> >(m, v);
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION where_expression<T, Abi, simd<T, Abi> const>
+where(simd_mask<T, Abi> const& m, simd<T, Abi> const& v) {
+  return where_expression<T, Abi, simd<T, Abi> const>(m, v);
+}
+
+/// Sum of the selected lanes.
+template <class T, class Abi, class V>
+KOKKOS_FORCEINLINE_FUNCTION T reduce(where_expression<T, Abi, V> const& w) {
+  return reduce(w.blend(simd<T, Abi>(Kokkos::reduction_identity<T>::sum())));
+}
+
+/// Minimum over the selected lanes.
+template <class T, class Abi, class V>
+KOKKOS_FORCEINLINE_FUNCTION T hmin(where_expression<T, Abi, V> const& w) {
+  return hmin(w.blend(simd<T, Abi>(Kokkos::reduction_identity<T>::min())));
+}
+
+/// Maximum over the selected lanes.
+template <class T, class Abi, class V>
+KOKKOS_FORCEINLINE_FUNCTION T hmax(where_expression<T, Abi, V> const& w) {
+  return hmax(w.blend(simd<T, Abi>(Kokkos::reduction_identity<T>::max())));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #ifndef KOKKOS_SIMD_HPP */
@@ -64,6 +64,7 @@
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 #include <impl/Kokkos_FunctorAdapter.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
+#include <impl/Kokkos_HostMDRangeTuner.hpp>
 
 #include <KokkosExp_MDRangePolicy.hpp>
 
@@ -842,7 +843,15 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
   }
 
  public:
-  inline void execute() const { this->exec(); }
+  inline void execute() const {
+    if (m_mdr_policy.m_tune_tiles && HostMDRangeTuner::is_enabled()) {
+      // The tuned policy has explicit tiles and so is not tuned again
+      HostMDRangeTunedLaunch<MDRangePolicy> launch(m_mdr_policy, m_functor, 1);
+      ParallelFor(m_functor, launch.policy()).execute();
+    } else {
+      this->exec();
+    }
+  }
 
   inline ParallelFor(const FunctorType& arg_functor,
                      const MDRangePolicy& arg_policy)
@@ -51,6 +51,9 @@ namespace Impl {
 template <class functor_type, class execution_space, class... policy_args>
 class WorkGraphExec;
 
+template <class Policy>
+class WorkGraphHostQueues;
+
 }
 }  // namespace Kokkos
 
@@ -75,6 +78,9 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   };
 
  private:
+  template <class Policy>
+  friend class Kokkos::Impl::WorkGraphHostQueues;
+
   using ints_type = Kokkos::View<std::int32_t*, memory_space>;
 
   // Let N = m_graph.numRows(), the total work
@@ -233,6 +239,220 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
 
 }  // namespace Kokkos
 
+namespace Kokkos {
+namespace Impl {
+
+/**\brief  Per-thread ready queues for executing a WorkGraphPolicy
+ *         on a host thread pool.
+ *
+ *  Each pool thread owns a bounded work-stealing deque.  Work made ready
+ *  by a thread's completed work is pushed onto its own deque, popped
+ *  last-in first-out by the owner and stolen first-in first-out by idle
+ *  threads.  The initially ready work, and work which does not fit in a
+ *  deque, goes through the policy's shared queue which is drained a batch
+ *  at a time.  Completed work is counted per thread and only published
+ *  when the thread runs out of work, which is also when it checks
+ *  whether the whole graph has completed.
+ */
+template <class Policy>
+class WorkGraphHostQueues {
+ public:
+  enum : std::int32_t { deque_capacity = 1024 };
+  enum : std::int32_t { batch_size = 16 };
+
+ private:
+  enum : std::int32_t { deque_mask = deque_capacity - 1 };
+
+  // Per thread [ top , bottom , work[ deque_capacity ] ]
+  // with top and bottom on separate cache lines.
+  enum : std::int32_t { line = 64 / sizeof(std::int32_t) };
+  enum : std::int32_t { stride = 2 * line + deque_capacity };
+
+  Policy m_policy;
+  Kokkos::View<std::int32_t*, Kokkos::HostSpace> m_data;
+  int m_pool_size;
+
+  std::int32_t volatile* top(const int rank) const noexcept {
+    return m_data.data() + rank * stride;
+  }
+
+  std::int32_t volatile* bottom(const int rank) const noexcept {
+    return m_data.data() + rank * stride + line;
+  }
+
+  std::int32_t volatile* deque(const int rank) const noexcept {
+    return m_data.data() + rank * stride + 2 * line;
+  }
+
+  std::int32_t volatile* completed_count() const noexcept {
+    return m_data.data() + m_pool_size * stride;
+  }
+
+  // Owner pushes to the bottom, overflow goes to the shared queue
+  void push(const int rank, const std::int32_t w) const noexcept {
+    std::int32_t volatile* const b_ptr = bottom(rank);
+
+    const std::int32_t b = *b_ptr;
+
+    if (deque_capacity <= b - *top(rank)) {
+      m_policy.push_work(w);
+    } else {
+      deque(rank)[b & deque_mask] = w;
+      memory_fence();
+      *b_ptr = b + 1;
+    }
+  }
+
+  // Owner pops from the bottom, racing thieves only for the last entry
+  std::int32_t pop(const int rank) const noexcept {
+    std::int32_t volatile* const t_ptr = top(rank);
+    std::int32_t volatile* const b_ptr = bottom(rank);
+
+    const std::int32_t b = *b_ptr - 1;
+
+    *b_ptr = b;
+    memory_fence();
+
+    const std::int32_t t = *t_ptr;
+
+    if (b < t) {
+      *b_ptr = b + 1;
+      return Policy::END_TOKEN;
+    }
+
+    std::int32_t w = deque(rank)[b & deque_mask];
+
+    if (b == t) {
+      if (t != atomic_compare_exchange(t_ptr, t, t + 1)) {
+        w = Policy::END_TOKEN;
+      }
+      *b_ptr = b + 1;
+    }
+
+    return w;
+  }
+
+  // Thieves take from the top
+  std::int32_t steal(const int rank) const noexcept {
+    std::int32_t volatile* const t_ptr = top(rank);
+
+    const std::int32_t t = *t_ptr;
+    memory_fence();
+    const std::int32_t b = *bottom(rank);
+
+    if (t < b) {
+      // The entry must not be read before bottom, which the owner
+      // publishes after writing it
+      memory_fence();
+      const std::int32_t w = deque(rank)[t & deque_mask];
+      if (t == atomic_compare_exchange(t_ptr, t, t + 1)) return w;
+    }
+
+    return Policy::END_TOKEN;
+  }
+
+  // Claim a batch from the head of the shared queue with a single
+  // compare-exchange, keep the first and push the rest onto the deque.
+  std::int32_t pop_shared(const int rank) const noexcept {
+    const std::int32_t N = m_policy.m_graph.numRows();
+
+    std::int32_t volatile* const ready_queue = &m_policy.m_queue[0];
+    std::int32_t volatile* const begin       = &m_policy.m_queue[2 * N];
+    std::int32_t volatile* const end         = &m_policy.m_queue[2 * N + 1];
+
+    std::int32_t b = *begin;
+    std::int32_t n = 0;
+
+    while (1) {
+      const std::int32_t e = *end;
+
+      if (e <= b) return Policy::END_TOKEN;
+
+      // Share what is ready across the pool
+      n = (e - b + m_pool_size - 1) / m_pool_size;
+      n = n < batch_size ? n : batch_size;
+
+      const std::int32_t old = atomic_compare_exchange(begin, b, b + n);
+
+      if (old == b) break;
+
+      b = old;
+    }
+
+    // A claimed entry may still be in the middle of its push_work
+    std::int32_t w = Policy::END_TOKEN;
+
+    for (std::int32_t i = n; 0 < i--;) {
+      while (Policy::END_TOKEN == (w = ready_queue[b + i]))
+        ;
+      if (0 < i) push(rank, w);
+    }
+
+    return w;
+  }
+
+  void completed_work(const int rank, const std::int32_t w) const noexcept {
+    Kokkos::memory_fence();
+
+    const std::int32_t N = m_policy.m_graph.numRows();
+
+    std::int32_t volatile* const count_queue = &m_policy.m_queue[N];
+
+    const std::int32_t B = m_policy.m_graph.row_map(w);
+    const std::int32_t E = m_policy.m_graph.row_map(w + 1);
+
+    for (std::int32_t i = B; i < E; ++i) {
+      const std::int32_t j = m_policy.m_graph.entries(i);
+      if (1 == atomic_fetch_add(count_queue + j, -1)) {
+        push(rank, j);
+      }
+    }
+  }
+
+ public:
+  WorkGraphHostQueues(const Policy& arg_policy, const int arg_pool_size)
+      : m_policy(arg_policy),
+        m_data("Kokkos::WorkGraphHostQueues",
+               arg_pool_size * stride + line),
+        m_pool_size(arg_pool_size) {}
+
+  /**\brief  Execute work on pool thread 'rank' until the graph completed.
+   *
+   *  Every pool thread must call this, closure( w ) executes work 'w'.
+   */
+  template <class Closure>
+  void execute(const int rank, const Closure& closure) const {
+    const std::int32_t N = m_policy.m_graph.numRows();
+
+    std::int32_t done = 0;
+
+    while (1) {
+      std::int32_t w = pop(rank);
+
+      if (Policy::END_TOKEN == w) w = pop_shared(rank);
+
+      for (int i = 1; Policy::END_TOKEN == w && i < m_pool_size; ++i) {
+        w = steal((rank + i) % m_pool_size);
+      }
+
+      if (Policy::END_TOKEN != w) {
+        closure(w);
+        completed_work(rank, w);
+        ++done;
+      } else {
+        if (done) {
+          atomic_fetch_add(completed_count(), done);
+          done = 0;
+        }
+        if (N <= *completed_count()) break;
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
 #ifdef KOKKOS_ENABLE_SERIAL
 #include "impl/Kokkos_Serial_WorkGraphPolicy.hpp"
 #endif
@@ -48,14 +48,17 @@
 #include <cstdio>
 #include <cstdlib>
 
+#include <atomic>
 #include <limits>
 #include <iostream>
+#include <thread>
 #include <vector>
 
 #include <Kokkos_Core.hpp>
 
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
+#include <impl/Kokkos_HostBarrier.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 
 namespace Kokkos {
@@ -66,6 +69,9 @@ int g_openmp_hardware_max_threads = 1;
 __thread int t_openmp_hardware_id            = 0;
 __thread Impl::OpenMPExec *t_openmp_instance = nullptr;
 
+__thread int t_openmp_pool_rank = -1;
+__thread int t_openmp_pool_size = 0;
+
 void OpenMPExec::validate_partition(const int nthreads, int &num_partitions,
                                     int &partition_size) {
   if (nthreads == 1) {
@@ -232,6 +238,15 @@ void OpenMPExec::resize_thread_data(size_t pool_reduce_bytes,
                                    pool_reduce_bytes, team_reduce_bytes,
                                    team_shared_bytes, thread_local_bytes);
 
+      if (Kokkos::hwloc::available()) {
+        // Hardware coordinate for locality-ordered work stealing.
+        // Only meaningful when threads are bound, e.g., OMP_PROC_BIND.
+        // The hwloc query is not thread safe.
+#pragma omp critical
+        m_pool[rank]->set_thread_coordinate(
+            Kokkos::hwloc::get_this_thread_coordinate());
+      }
+
       memory_fence();
     }
     /* END #pragma omp parallel */
@@ -240,6 +255,112 @@ void OpenMPExec::resize_thread_data(size_t pool_reduce_bytes,
   }
 }
 
+//----------------------------------------------------------------------------
+
+/** \brief  Workers parked between kernels of a persistent OpenMPExec.
+ *
+ *  A helper thread opens one OpenMP parallel region of pool_size - 1
+ *  threads which take pool ranks 1 .. pool_size - 1 and wait on 'start'.
+ *  The master publishes the work, arrives at 'start', executes rank zero
+ *  and waits on 'done' for the workers.  The barrier waits spin for
+ *  KOKKOS_SPIN_WAIT_US before blocking so that back to back kernels
+ *  find the workers awake.
+ */
+struct OpenMPPersistent {
+  alignas(64) int start_buffer[HostBarrier::required_buffer_length];
+  alignas(64) int done_buffer[HostBarrier::required_buffer_length];
+
+  HostBarrier start;
+  HostBarrier done;
+
+  void (*function)(const void *);
+  const void *closure;
+  std::atomic<bool> stop;
+
+  std::thread helper;
+
+  OpenMPPersistent(const int pool_size)
+      : start_buffer(),
+        done_buffer(),
+        start(pool_size, start_buffer),
+        done(pool_size, done_buffer),
+        function(nullptr),
+        closure(nullptr),
+        stop(false),
+        helper() {}
+
+  void work(const int pool_size) {
+#pragma omp parallel num_threads(pool_size - 1)
+    {
+      t_openmp_pool_rank   = omp_get_thread_num() + 1;
+      t_openmp_pool_size   = pool_size;
+      t_openmp_hardware_id = t_openmp_pool_rank;
+      SharedAllocationRecord<void, void>::tracking_enable();
+
+      HostBarrier worker_start(pool_size, start_buffer);
+      HostBarrier worker_done(pool_size, done_buffer);
+
+      while (true) {
+        worker_start.arrive();
+        worker_start.wait();
+
+        if (stop.load(std::memory_order_acquire)) break;
+
+        (*function)(closure);
+
+        worker_done.arrive();
+      }
+
+      t_openmp_pool_rank = -1;
+      t_openmp_pool_size = 0;
+    }
+  }
+};
+
+void OpenMPExec::start_persistent() {
+  if (m_persistent || m_pool_size < 2) return;
+
+  m_persistent = new OpenMPPersistent(m_pool_size);
+
+  m_persistent->helper =
+      std::thread(&OpenMPPersistent::work, m_persistent, m_pool_size);
+}
+
+void OpenMPExec::stop_persistent() {
+  if (!m_persistent) return;
+
+  m_persistent->stop.store(true, std::memory_order_release);
+  m_persistent->start.arrive();
+  m_persistent->start.wait();
+  m_persistent->helper.join();
+
+  delete m_persistent;
+  m_persistent = nullptr;
+}
+
+void OpenMPExec::persistent_launch(void (*function)(const void *),
+                                   const void *closure) const {
+  OpenMPPersistent &p = *m_persistent;
+
+  p.function = function;
+  p.closure  = closure;
+
+  // Arriving fences the work descriptor before the workers are released
+  p.start.arrive();
+  p.start.wait();
+
+  t_openmp_pool_rank = 0;
+  t_openmp_pool_size = m_pool_size;
+
+  (*function)(closure);
+
+  t_openmp_pool_rank = -1;
+  t_openmp_pool_size = 0;
+
+  p.done.arrive();
+  p.done.wait();
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -372,6 +493,13 @@ void OpenMP::impl_initialize(int thread_count)
           pool_reduce_bytes, team_reduce_bytes, team_shared_bytes,
           thread_local_bytes);
     }
+
+    // KOKKOS_OPENMP_PERSISTENT=1 parks the workers between kernels,
+    // see OpenMPExec::start_persistent for the restrictions this implies.
+    const char *persistent = std::getenv("KOKKOS_OPENMP_PERSISTENT");
+    if (nullptr != persistent && 0 < std::atoi(persistent)) {
+      Impl::t_openmp_instance->start_persistent();
+    }
   }
 
   // Check for over-subscription
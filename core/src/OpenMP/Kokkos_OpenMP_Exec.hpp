@@ -81,6 +81,13 @@ extern int g_openmp_hardware_max_threads;
 extern __thread int t_openmp_hardware_id;
 extern __thread OpenMPExec* t_openmp_instance;
 
+// Pool rank and size of a thread executing work dispatched to the
+// persistent workers, the rank is -1 otherwise.
+extern __thread int t_openmp_pool_rank;
+extern __thread int t_openmp_pool_size;
+
+struct OpenMPPersistent;
+
 //----------------------------------------------------------------------------
 /** \brief  Data for OpenMP thread execution */
 
@@ -97,23 +104,80 @@ class OpenMPExec {
 
  private:
   OpenMPExec(int arg_pool_size)
-      : m_pool_size{arg_pool_size}, m_level{omp_get_level()}, m_pool() {}
-
-  ~OpenMPExec() { clear_thread_data(); }
+      : m_pool_size{arg_pool_size},
+        m_level{omp_get_level()},
+        m_persistent{nullptr},
+        m_pool() {}
+
+  ~OpenMPExec() {
+    stop_persistent();
+    clear_thread_data();
+  }
 
   int m_pool_size;
   int m_level;
 
+  OpenMPPersistent* m_persistent;
+
   HostThreadTeamData* m_pool[MAX_THREAD_COUNT];
 
+  template <class Closure>
+  static void persistent_apply(const void* closure) {
+    (*static_cast<const Closure*>(closure))();
+  }
+
+  void persistent_launch(void (*)(const void*), const void*) const;
+
  public:
   static void verify_is_master(const char* const);
 
   void resize_thread_data(size_t pool_reduce_bytes, size_t team_reduce_bytes,
                           size_t team_shared_bytes, size_t thread_local_bytes);
 
+  /** \brief  Park pool_size - 1 worker threads on a spin barrier.
+   *
+   *  While started, parallel_region dispatches to the parked workers and
+   *  the calling thread as rank zero instead of forking a new OpenMP
+   *  parallel region for every kernel.  Enabled at initialization by
+   *  setting the KOKKOS_OPENMP_PERSISTENT environment variable to 1.
+   *
+   *  The workers belong to an OpenMP team opened by a helper std::thread,
+   *  not by the calling thread, which has two consequences:
+   *  - The helper is an extra OS thread outside of the OpenMP runtime's
+   *    thread binding, so OMP_PROC_BIND / OMP_PLACES affinity is relative
+   *    to the helper rather than the master and the master's own place
+   *    is not reserved.
+   *  - Inside kernels omp_get_thread_num() and omp_in_parallel() do not
+   *    describe the Kokkos pool: the master reports 0 and not in
+   *    parallel, the workers report their rank minus one.  Kernels must
+   *    use the Kokkos thread ids instead.
+   */
+  void start_persistent();
+  void stop_persistent();
+
+  bool is_persistent() const noexcept { return nullptr != m_persistent; }
+
+  /** \brief  Call closure() once on every thread of the pool.
+   *
+   *  Within the closure use get_thread_data() and its pool rendezvous
+   *  rather than omp_get_thread_num() and OpenMP barriers, which do not
+   *  apply to the persistent workers.
+   */
+  template <class Closure>
+  inline void parallel_region(const int pool_size,
+                              const Closure& closure) const {
+    if (m_persistent && pool_size == m_pool_size) {
+      persistent_launch(&OpenMPExec::persistent_apply<Closure>, &closure);
+    } else {
+#pragma omp parallel num_threads(pool_size)
+      { closure(); }
+    }
+  }
+
   inline HostThreadTeamData* get_thread_data() const noexcept {
-    return m_pool[m_level == omp_get_level() ? 0 : omp_get_thread_num()];
+    return m_pool[0 <= t_openmp_pool_rank
+                      ? t_openmp_pool_rank
+                      : m_level == omp_get_level() ? 0 : omp_get_thread_num()];
   }
 
   inline HostThreadTeamData* get_thread_data(int i) const noexcept {
@@ -143,7 +207,7 @@ inline
 
 inline bool OpenMP::in_parallel(OpenMP const&) noexcept {
   // t_openmp_instance is only non-null on a master thread
-  return !Impl::t_openmp_instance ||
+  return !Impl::t_openmp_instance || 0 <= Impl::t_openmp_pool_rank ||
          Impl::t_openmp_instance->m_level < omp_get_level();
 }
 
@@ -156,8 +220,10 @@ inline
     OpenMP::impl_thread_pool_size() noexcept
 #endif
 {
-  return OpenMP::in_parallel() ? omp_get_num_threads()
-                               : Impl::t_openmp_instance->m_pool_size;
+  return 0 <= Impl::t_openmp_pool_rank
+             ? Impl::t_openmp_pool_size
+             : OpenMP::in_parallel() ? omp_get_num_threads()
+                                     : Impl::t_openmp_instance->m_pool_size;
 }
 
 KOKKOS_INLINE_FUNCTION
@@ -168,7 +234,9 @@ int OpenMP::impl_thread_pool_rank() noexcept
 #endif
 {
 #if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
-  return Impl::t_openmp_instance ? 0 : omp_get_thread_num();
+  return 0 <= Impl::t_openmp_pool_rank
+             ? Impl::t_openmp_pool_rank
+             : Impl::t_openmp_instance ? 0 : omp_get_thread_num();
 #else
   return -1;
 #endif
@@ -0,0 +1,160 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_OPENMP_FUSEDFOR_HPP
+#define KOKKOS_OPENMP_FUSEDFOR_HPP
+
+namespace Kokkos {
+namespace Impl {
+
+/// Run all stages within one parallel region.  Each thread applies every
+/// stage to the same static partition of the range, so pointwise
+/// dependencies between stages never cross threads and only a FusedBarrier
+/// needs a pool rendezvous.
+template <class List, class... Traits>
+class FusedFor<List, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
+ private:
+  typedef Kokkos::RangePolicy<Traits...> Policy;
+  typedef typename Policy::work_tag WorkTag;
+  typedef typename Policy::member_type Member;
+
+  OpenMPExec* m_instance;
+  const List m_stages;
+  const Policy m_policy;
+
+  template <class TagType, class Stage>
+  inline static
+      typename std::enable_if<std::is_same<TagType, void>::value>::type
+      exec_range(const Stage& stage, const Member ibeg, const Member iend) {
+#ifdef KOKKOS_ENABLE_AGGRESSIVE_VECTORIZATION
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#endif
+    for (Member iwork = ibeg; iwork < iend; ++iwork) {
+      stage(iwork);
+    }
+  }
+
+  template <class TagType, class Stage>
+  inline static
+      typename std::enable_if<!std::is_same<TagType, void>::value>::type
+      exec_range(const Stage& stage, const Member ibeg, const Member iend) {
+    const TagType t{};
+#ifdef KOKKOS_ENABLE_AGGRESSIVE_VECTORIZATION
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#endif
+    for (Member iwork = ibeg; iwork < iend; ++iwork) {
+      stage(t, iwork);
+    }
+  }
+
+  // 'data' is null when the stages run serially on one thread
+  inline static void exec_stages(const FusedStages<>&, const Member,
+                                 const Member, HostThreadTeamData*) {}
+
+  template <class... Stages>
+  inline static void exec_stages(
+      const FusedStages<Kokkos::Experimental::FusedBarrier, Stages...>& s,
+      const Member ibeg, const Member iend, HostThreadTeamData* data) {
+    if (data && data->pool_rendezvous()) data->pool_rendezvous_release();
+    exec_stages(s.m_tail, ibeg, iend, data);
+  }
+
+  template <class Stage, class... Stages>
+  inline static void exec_stages(const FusedStages<Stage, Stages...>& s,
+                                 const Member ibeg, const Member iend,
+                                 HostThreadTeamData* data) {
+    exec_range<WorkTag>(s.m_head, ibeg, iend);
+    exec_stages(s.m_tail, ibeg, iend, data);
+  }
+
+ public:
+  inline void execute() const {
+    if (OpenMP::in_parallel()) {
+      exec_stages(m_stages, m_policy.begin(), m_policy.end(), nullptr);
+      return;
+    }
+
+    OpenMPExec::verify_is_master("Kokkos::OpenMP fused_for");
+
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+    const int pool_size = OpenMP::thread_pool_size();
+#else
+    const int pool_size = OpenMP::impl_thread_pool_size();
+#endif
+
+    const int64_t length = m_policy.end() - m_policy.begin();
+
+    m_instance->parallel_region(pool_size, [&]() {
+      HostThreadTeamData& data = *(m_instance->get_thread_data());
+
+      data.set_work_partition(length, m_policy.chunk_size());
+
+      const std::pair<int64_t, int64_t> range = data.get_work_partition();
+
+      // An empty partition must still reach every barrier
+      const Member ibeg = range.first < range.second
+                              ? Member(range.first + m_policy.begin())
+                              : m_policy.begin();
+      const Member iend = range.first < range.second
+                              ? Member(range.second + m_policy.begin())
+                              : m_policy.begin();
+
+      exec_stages(m_stages, ibeg, iend, &data);
+    });
+  }
+
+  inline FusedFor(const List& arg_stages, const Policy& arg_policy)
+      : m_instance(t_openmp_instance),
+        m_stages(arg_stages),
+        m_policy(arg_policy) {}
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* #define KOKKOS_OPENMP_FUSEDFOR_HPP */
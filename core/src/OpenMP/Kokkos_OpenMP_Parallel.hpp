@@ -52,6 +52,8 @@
 #include <iostream>
 #include <OpenMP/Kokkos_OpenMP_Exec.hpp>
 #include <impl/Kokkos_FunctorAdapter.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
+#include <impl/Kokkos_HostMDRangeTuner.hpp>
 
 #include <KokkosExp_MDRangePolicy.hpp>
 
@@ -61,6 +63,134 @@
 namespace Kokkos {
 namespace Impl {
 
+/** \brief  Join every thread's 'pool_reduce_local()' contribution into
+ *          that of thread zero with a log-depth tree.
+ *
+ *  Must be called by every thread of the parallel region.  Each partial
+ *  value resides in its thread's own HostThreadTeamData allocation so
+ *  concurrent joins never share a cache line.  Synchronizes with the pool
+ *  rendezvous so that it also applies to the persistent workers.
+ */
+template <class ValueJoin, class FunctorType>
+inline void openmp_pool_tree_reduce(const FunctorType& functor,
+                                    const OpenMPExec& instance,
+                                    HostThreadTeamData& data) {
+  const int rank      = data.pool_rank();
+  const int pool_size = data.pool_size();
+  void* const dest    = data.pool_reduce_local();
+
+  for (int stride = 1; stride < pool_size; stride <<= 1) {
+    if (data.pool_rendezvous()) data.pool_rendezvous_release();
+    if (0 == (rank & (2 * stride - 1)) && rank + stride < pool_size) {
+      ValueJoin::join(
+          functor, dest,
+          instance.get_thread_data(rank + stride)->pool_reduce_local());
+    }
+  }
+}
+
+/** \brief  Single-pass parallel_scan with decoupled look-back.
+ *
+ *  Each thread's 'pool_reduce_local()' holds, in order, the aggregate of
+ *  its range, the exclusive prefix of its range, the inclusive prefix of
+ *  its range, and a status word.  A thread publishes its aggregate, then
+ *  looks back over lower ranks until it finds a published inclusive
+ *  prefix.  No thread waits on a higher rank so there is neither a pool
+ *  barrier nor a serial sweep between the two passes over the range.
+ */
+template <class Analysis, class ValueInit, class ValueJoin>
+struct OpenMPScanLookBack {
+  typedef typename Analysis::pointer_type pointer_type;
+
+  enum : int64_t { pending = 0, aggregate = 1, inclusive = 2 };
+
+  template <class FunctorType>
+  static int status_offset(const FunctorType& functor) {
+    return (3 * Analysis::value_size(functor) + sizeof(int64_t) - 1) /
+           sizeof(int64_t);
+  }
+
+  template <class FunctorType>
+  static size_t pool_reduce_bytes(const FunctorType& functor) {
+    return (status_offset(functor) + 1) * sizeof(int64_t);
+  }
+
+  /** \brief  Master thread clears status before the parallel region. */
+  template <class FunctorType>
+  static void reset(const FunctorType& functor, const OpenMPExec& instance,
+                    const int pool_size) {
+    const int offset = status_offset(functor);
+    for (int i = 0; i < pool_size; ++i) {
+      instance.get_thread_data(i)->pool_reduce_local()[offset] = pending;
+    }
+  }
+
+  /** \brief  Called after the aggregate of this thread's range is
+   *          accumulated.  Returns the exclusive prefix of the range.
+   */
+  template <class FunctorType>
+  static pointer_type look_back(const FunctorType& functor,
+                                const OpenMPExec& instance, const int rank) {
+    const int count  = Analysis::value_count(functor);
+    const int offset = status_offset(functor);
+
+    int64_t* const local = instance.get_thread_data(rank)->pool_reduce_local();
+    int64_t volatile& status = local[offset];
+
+    const pointer_type ptr = (pointer_type)local;
+
+    memory_fence();
+    status = aggregate;
+
+    // Find the nearest lower rank with a published inclusive prefix
+    int base = rank - 1;
+    for (; 0 <= base; --base) {
+      int64_t volatile& base_status =
+          instance.get_thread_data(base)->pool_reduce_local()[offset];
+      spinwait_while_equal<int64_t>(base_status, pending);
+      if (inclusive == base_status) break;
+    }
+
+    // Order the reads of the partials after the status reads
+    memory_fence();
+
+    // Join forward from that prefix to preserve the order of the scan
+    if (0 <= base) {
+      const pointer_type src =
+          (pointer_type)instance.get_thread_data(base)->pool_reduce_local();
+      for (int j = 0; j < count; ++j) {
+        ptr[j + count] = src[j + 2 * count];
+      }
+    } else {
+      ValueInit::init(functor, ptr + count);
+    }
+
+    for (int i = base + 1; i < rank; ++i) {
+      ValueJoin::join(functor, ptr + count,
+                      instance.get_thread_data(i)->pool_reduce_local());
+    }
+
+    for (int j = 0; j < count; ++j) {
+      ptr[j + 2 * count] = ptr[j + count];
+    }
+    ValueJoin::join(functor, ptr + 2 * count, ptr);
+
+    memory_fence();
+    status = inclusive;
+
+    return ptr + count;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
 template <class FunctorType, class... Traits>
 class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
  private:
@@ -105,10 +235,21 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
   }
 
  public:
+  /** \brief  State of the Adaptive schedule, shared by all launches
+   *          of this functor and policy type.
+   */
+  static HostAdaptiveChunk& adaptive_chunk() {
+    static HostAdaptiveChunk adaptive;
+    return adaptive;
+  }
+
   inline void execute() const {
+    typedef typename Policy::schedule_type::type schedule;
+
     enum {
-      is_dynamic = std::is_same<typename Policy::schedule_type::type,
-                                Kokkos::Dynamic>::value
+      is_dynamic  = std::is_same<schedule, Kokkos::Dynamic>::value,
+      is_adaptive = std::is_same<schedule, Kokkos::Adaptive>::value,
+      is_guided   = std::is_same<schedule, Kokkos::Guided>::value || is_adaptive
     };
 
     if (OpenMP::in_parallel()) {
@@ -117,17 +258,29 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
       OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_for");
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-#pragma omp parallel num_threads(OpenMP::thread_pool_size())
+      const int pool_size = OpenMP::thread_pool_size();
 #else
-#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
+      const int pool_size = OpenMP::impl_thread_pool_size();
 #endif
-      {
+
+      HostAdaptiveChunk& adaptive = adaptive_chunk();
+
+      const int64_t length = m_policy.end() - m_policy.begin();
+      const int64_t guided_chunk =
+          is_adaptive ? adaptive.chunk_size(m_policy.chunk_size())
+                      : int64_t(m_policy.chunk_size());
+
+      int64_t busy_sum = 0;
+      int64_t busy_max = 0;
+
+      m_instance->parallel_region(pool_size, [&]() {
         HostThreadTeamData& data = *(m_instance->get_thread_data());
 
-        data.set_work_partition(m_policy.end() - m_policy.begin(),
-                                m_policy.chunk_size());
+        const double busy_begin = is_adaptive ? omp_get_wtime() : 0.0;
 
-        if (is_dynamic) {
+        data.set_work_partition(length, m_policy.chunk_size());
+
+        if (is_dynamic || is_guided) {
           // Make sure work partition is set before stealing
           if (data.pool_rendezvous()) data.pool_rendezvous_release();
         }
@@ -135,14 +288,26 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
-                             : data.get_work_partition();
+          range = is_guided ? data.get_work_guided_chunk(guided_chunk)
+                            : is_dynamic ? data.get_work_stealing_chunk()
+                                         : data.get_work_partition();
 
           ParallelFor::template exec_range<WorkTag>(
               m_functor, range.first + m_policy.begin(),
               range.second + m_policy.begin());
 
-        } while (is_dynamic && 0 <= range.first);
+        } while ((is_dynamic || is_guided) && 0 <= range.first);
+
+        if (is_adaptive) {
+          const int64_t busy =
+              static_cast<int64_t>(1.0e9 * (omp_get_wtime() - busy_begin));
+          Kokkos::atomic_add(&busy_sum, busy);
+          Kokkos::atomic_fetch_max(&busy_max, busy);
+        }
+      });
+
+      if (is_adaptive) {
+        adaptive.update(guided_chunk, length, pool_size, busy_sum, busy_max);
       }
     }
   }
@@ -198,15 +363,21 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
     if (OpenMP::in_parallel()) {
       ParallelFor::exec_range(m_mdr_policy, m_functor, m_policy.begin(),
                               m_policy.end());
+    } else if (m_mdr_policy.m_tune_tiles && HostMDRangeTuner::is_enabled()) {
+      // The tuned policy has explicit tiles and so is not tuned again
+      HostMDRangeTunedLaunch<MDRangePolicy> launch(m_mdr_policy, m_functor,
+                                                   OpenMP::concurrency());
+      ParallelFor(m_functor, launch.policy()).execute();
     } else {
       OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_for");
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-#pragma omp parallel num_threads(OpenMP::thread_pool_size())
+      const int pool_size = OpenMP::thread_pool_size();
 #else
-#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
+      const int pool_size = OpenMP::impl_thread_pool_size();
 #endif
-      {
+
+      m_instance->parallel_region(pool_size, [&]() {
         HostThreadTeamData& data = *(m_instance->get_thread_data());
 
         data.set_work_partition(m_policy.end() - m_policy.begin(),
@@ -228,8 +399,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
                                   range.second + m_policy.begin());
 
         } while (is_dynamic && 0 <= range.first);
-      }
-      // END #pragma omp parallel
+      });
     }
   }
 
@@ -306,10 +476,21 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
   }
 
  public:
+  /** \brief  State of the Adaptive schedule, shared by all launches
+   *          of this functor and policy type.
+   */
+  static HostAdaptiveChunk& adaptive_chunk() {
+    static HostAdaptiveChunk adaptive;
+    return adaptive;
+  }
+
   inline void execute() const {
+    typedef typename Policy::schedule_type::type schedule;
+
     enum {
-      is_dynamic = std::is_same<typename Policy::schedule_type::type,
-                                Kokkos::Dynamic>::value
+      is_dynamic  = std::is_same<schedule, Kokkos::Dynamic>::value,
+      is_adaptive = std::is_same<schedule, Kokkos::Adaptive>::value,
+      is_guided   = std::is_same<schedule, Kokkos::Guided>::value || is_adaptive
     };
 
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_reduce");
@@ -329,14 +510,25 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
 #else
     const int pool_size = OpenMP::impl_thread_pool_size();
 #endif
-#pragma omp parallel num_threads(pool_size)
-    {
+
+    HostAdaptiveChunk& adaptive = adaptive_chunk();
+
+    const int64_t length = m_policy.end() - m_policy.begin();
+    const int64_t guided_chunk =
+        is_adaptive ? adaptive.chunk_size(m_policy.chunk_size())
+                    : int64_t(m_policy.chunk_size());
+
+    int64_t busy_sum = 0;
+    int64_t busy_max = 0;
+
+    m_instance->parallel_region(pool_size, [&]() {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
-      data.set_work_partition(m_policy.end() - m_policy.begin(),
-                              m_policy.chunk_size());
+      const double busy_begin = is_adaptive ? omp_get_wtime() : 0.0;
 
-      if (is_dynamic) {
+      data.set_work_partition(length, m_policy.chunk_size());
+
+      if (is_dynamic || is_guided) {
         // Make sure work partition is set before stealing
         if (data.pool_rendezvous()) data.pool_rendezvous_release();
       }
@@ -348,14 +540,30 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
       std::pair<int64_t, int64_t> range(0, 0);
 
       do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
-                           : data.get_work_partition();
+        range = is_guided ? data.get_work_guided_chunk(guided_chunk)
+                          : is_dynamic ? data.get_work_stealing_chunk()
+                                       : data.get_work_partition();
 
         ParallelReduce::template exec_range<WorkTag>(
             m_functor, range.first + m_policy.begin(),
             range.second + m_policy.begin(), update);
 
-      } while (is_dynamic && 0 <= range.first);
+      } while ((is_dynamic || is_guided) && 0 <= range.first);
+
+      if (is_adaptive) {
+        const int64_t busy =
+            static_cast<int64_t>(1.0e9 * (omp_get_wtime() - busy_begin));
+        Kokkos::atomic_add(&busy_sum, busy);
+        Kokkos::atomic_fetch_max(&busy_max, busy);
+      }
+
+      openmp_pool_tree_reduce<ValueJoin>(
+          ReducerConditional::select(m_functor, m_reducer), *m_instance,
+          data);
+    });
+
+    if (is_adaptive) {
+      adaptive.update(guided_chunk, length, pool_size, busy_sum, busy_max);
     }
 
     // Reduction:
@@ -363,11 +571,6 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
     const pointer_type ptr =
         pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
 
-    for (int i = 1; i < pool_size; ++i) {
-      ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
-                      m_instance->get_thread_data(i)->pool_reduce_local());
-    }
-
     Kokkos::Impl::FunctorFinal<ReducerTypeFwd, WorkTagFwd>::final(
         ReducerConditional::select(m_functor, m_reducer), ptr);
 
@@ -490,8 +693,7 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
 #else
     const int pool_size = OpenMP::impl_thread_pool_size();
 #endif
-#pragma omp parallel num_threads(pool_size)
-    {
+    m_instance->parallel_region(pool_size, [&]() {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       data.set_work_partition(m_policy.end() - m_policy.begin(),
@@ -517,19 +719,17 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
                                    range.second + m_policy.begin(), update);
 
       } while (is_dynamic && 0 <= range.first);
-    }
-    // END #pragma omp parallel
+
+      openmp_pool_tree_reduce<ValueJoin>(
+          ReducerConditional::select(m_functor, m_reducer), *m_instance,
+          data);
+    });
 
     // Reduction:
 
     const pointer_type ptr =
         pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
 
-    for (int i = 1; i < pool_size; ++i) {
-      ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
-                      m_instance->get_thread_data(i)->pool_reduce_local());
-    }
-
     Kokkos::Impl::FunctorFinal<ReducerTypeFwd, WorkTagFwd>::final(
         ReducerConditional::select(m_functor, m_reducer), ptr);
 
@@ -608,6 +808,8 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
   typedef typename Analysis::pointer_type pointer_type;
   typedef typename Analysis::reference_type reference_type;
 
+  typedef OpenMPScanLookBack<Analysis, ValueInit, ValueJoin> LookBack;
+
   OpenMPExec* m_instance;
   const FunctorType m_functor;
   const Policy m_policy;
@@ -637,8 +839,7 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
   inline void execute() const {
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_scan");
 
-    const int value_count          = Analysis::value_count(m_functor);
-    const size_t pool_reduce_bytes = 2 * Analysis::value_size(m_functor);
+    const size_t pool_reduce_bytes = LookBack::pool_reduce_bytes(m_functor);
 
     m_instance->resize_thread_data(pool_reduce_bytes, 0  // team_reduce_bytes
                                    ,
@@ -648,52 +849,29 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
     );
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-#pragma omp parallel num_threads(OpenMP::thread_pool_size())
+    const int pool_size = OpenMP::thread_pool_size();
 #else
-#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
+    const int pool_size = OpenMP::impl_thread_pool_size();
 #endif
-    {
-      HostThreadTeamData& data = *(m_instance->get_thread_data());
 
-      const WorkRange range(m_policy, omp_get_thread_num(),
-                            omp_get_num_threads());
+    LookBack::reset(m_functor, *m_instance, pool_size);
 
+    m_instance->parallel_region(pool_size, [&]() {
+      HostThreadTeamData& data = *(m_instance->get_thread_data());
+
+      const WorkRange range(m_policy, data.pool_rank(), data.pool_size());
       reference_type update_sum =
           ValueInit::init(m_functor, data.pool_reduce_local());
 
       ParallelScan::template exec_range<WorkTag>(
           m_functor, range.begin(), range.end(), update_sum, false);
 
-      if (data.pool_rendezvous()) {
-        pointer_type ptr_prev = 0;
-
-        const int n = omp_get_num_threads();
-
-        for (int i = 0; i < n; ++i) {
-          pointer_type ptr =
-              (pointer_type)data.pool_member(i)->pool_reduce_local();
-
-          if (i) {
-            for (int j = 0; j < value_count; ++j) {
-              ptr[j + value_count] = ptr_prev[j + value_count];
-            }
-            ValueJoin::join(m_functor, ptr + value_count, ptr_prev);
-          } else {
-            ValueInit::init(m_functor, ptr + value_count);
-          }
-
-          ptr_prev = ptr;
-        }
-
-        data.pool_rendezvous_release();
-      }
-
       reference_type update_base = ValueOps::reference(
-          ((pointer_type)data.pool_reduce_local()) + value_count);
+          LookBack::look_back(m_functor, *m_instance, data.pool_rank()));
 
       ParallelScan::template exec_range<WorkTag>(
           m_functor, range.begin(), range.end(), update_base, true);
-    }
+    });
   }
 
   //----------------------------------------
@@ -726,6 +904,8 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
   typedef typename Analysis::pointer_type pointer_type;
   typedef typename Analysis::reference_type reference_type;
 
+  typedef OpenMPScanLookBack<Analysis, ValueInit, ValueJoin> LookBack;
+
   OpenMPExec* m_instance;
   const FunctorType m_functor;
   const Policy m_policy;
@@ -756,8 +936,7 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
   inline void execute() const {
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_scan");
 
-    const int value_count          = Analysis::value_count(m_functor);
-    const size_t pool_reduce_bytes = 2 * Analysis::value_size(m_functor);
+    const size_t pool_reduce_bytes = LookBack::pool_reduce_bytes(m_functor);
 
     m_instance->resize_thread_data(pool_reduce_bytes, 0  // team_reduce_bytes
                                    ,
@@ -767,55 +946,33 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
     );
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-#pragma omp parallel num_threads(OpenMP::thread_pool_size())
+    const int pool_size = OpenMP::thread_pool_size();
 #else
-#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
+    const int pool_size = OpenMP::impl_thread_pool_size();
 #endif
-    {
+
+    LookBack::reset(m_functor, *m_instance, pool_size);
+
+    m_instance->parallel_region(pool_size, [&]() {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
-      const WorkRange range(m_policy, omp_get_thread_num(),
-                            omp_get_num_threads());
+      const WorkRange range(m_policy, data.pool_rank(), data.pool_size());
       reference_type update_sum =
           ValueInit::init(m_functor, data.pool_reduce_local());
 
       ParallelScanWithTotal::template exec_range<WorkTag>(
           m_functor, range.begin(), range.end(), update_sum, false);
 
-      if (data.pool_rendezvous()) {
-        pointer_type ptr_prev = 0;
-
-        const int n = omp_get_num_threads();
-
-        for (int i = 0; i < n; ++i) {
-          pointer_type ptr =
-              (pointer_type)data.pool_member(i)->pool_reduce_local();
-
-          if (i) {
-            for (int j = 0; j < value_count; ++j) {
-              ptr[j + value_count] = ptr_prev[j + value_count];
-            }
-            ValueJoin::join(m_functor, ptr + value_count, ptr_prev);
-          } else {
-            ValueInit::init(m_functor, ptr + value_count);
-          }
-
-          ptr_prev = ptr;
-        }
-
-        data.pool_rendezvous_release();
-      }
-
       reference_type update_base = ValueOps::reference(
-          ((pointer_type)data.pool_reduce_local()) + value_count);
+          LookBack::look_back(m_functor, *m_instance, data.pool_rank()));
 
       ParallelScanWithTotal::template exec_range<WorkTag>(
           m_functor, range.begin(), range.end(), update_base, true);
 
-      if (omp_get_thread_num() == omp_get_num_threads() - 1) {
+      if (data.pool_rank() == data.pool_size() - 1) {
         m_returnvalue = update_base;
       }
-    }
+    });
   }
 
   //----------------------------------------
@@ -912,11 +1069,12 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
                                    team_shared_size, thread_local_size);
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-#pragma omp parallel num_threads(OpenMP::thread_pool_size())
+    const int pool_size = OpenMP::thread_pool_size();
 #else
-#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
+    const int pool_size = OpenMP::impl_thread_pool_size();
 #endif
-    {
+
+    m_instance->parallel_region(pool_size, [&]() {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       const int active = data.organize_team(m_policy.team_size());
@@ -949,7 +1107,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
       }
 
       data.disband_team();
-    }
+    });
   }
 
   inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
@@ -1062,8 +1220,7 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
 #else
     const int pool_size = OpenMP::impl_thread_pool_size();
 #endif
-#pragma omp parallel num_threads(pool_size)
-    {
+    m_instance->parallel_region(pool_size, [&]() {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       const int active = data.organize_team(m_policy.team_size());
@@ -1105,26 +1262,21 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
       data.disband_team();
 
       //  This thread has updated 'pool_reduce_local()' with its
-      //  contributions to the reduction.  The parallel region is
-      //  about to terminate and the master thread will load and
-      //  reduce each 'pool_reduce_local()' contribution.
-      //  Must 'memory_fence()' to guarantee that storing the update to
-      //  'pool_reduce_local()' will complete before this thread
-      //  exits the parallel region.
-
-      memory_fence();
-    }
+      //  contributions to the reduction.  Join the contributions of
+      //  the pool into thread zero's 'pool_reduce_local()'; each level
+      //  of the tree begins with a barrier which also guarantees the
+      //  updates are visible.
+
+      openmp_pool_tree_reduce<ValueJoin>(
+          ReducerConditional::select(m_functor, m_reducer), *m_instance,
+          data);
+    });
 
     // Reduction:
 
     const pointer_type ptr =
         pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
 
-    for (int i = 1; i < pool_size; ++i) {
-      ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
-                      m_instance->get_thread_data(i)->pool_reduce_local());
-    }
-
     Kokkos::Impl::FunctorFinal<ReducerTypeFwd, WorkTagFwd>::final(
         ReducerConditional::select(m_functor, m_reducer), ptr);
 
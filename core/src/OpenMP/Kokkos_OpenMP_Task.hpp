@@ -51,6 +51,7 @@
 #include <Kokkos_TaskScheduler_fwd.hpp>
 
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_TaskTracer.hpp>
 #include <Kokkos_OpenMP.hpp>
 
 #include <type_traits>
@@ -115,10 +116,17 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType> > {
 
     // queue.initialize_team_queues(pool_size / team_size);
 
+    const bool traced = TaskTracer::begin_execute(pool_size);
+
 #pragma omp parallel num_threads(pool_size)
     {
       Impl::HostThreadTeamData& self = *(instance->get_thread_data());
 
+      TaskTraceWorker* const trace =
+          traced ? TaskTracer::worker(self.pool_rank()) : nullptr;
+
+      if (trace) trace->start();
+
       // Organizing threads into a team performs a barrier across the
       // entire pool to insure proper initialization of the team
       // rendezvous mechanism before a team rendezvous can be performed.
@@ -143,16 +151,24 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType> > {
               current_task =
                   queue.pop_ready_task(team_scheduler.team_scheduler_info());
 
+              if (trace) trace->count_pop();
+
               if (current_task) {
                 if (current_task->is_team_runnable()) {
                   // break out of the team leader loop to run the team task
                   break;
                 } else {
                   KOKKOS_ASSERT(current_task->is_single_runnable());
+                  if (trace) {
+                    trace->begin_execute();
+                    trace->sample_depth(queue.ready_count());
+                  }
                   current_task->as_runnable_task().run(single_exec);
+                  if (trace) trace->end_execute();
                   // Respawns are handled in the complete function
                   queue.complete((*std::move(current_task)).as_runnable_task(),
                                  team_scheduler.team_scheduler_info());
+                  if (trace) trace->end_complete();
                 }
 
               }  // end if current_task is not null
@@ -167,17 +183,22 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType> > {
 
           if (current_task) {
             KOKKOS_ASSERT(current_task->is_team_runnable());
+            if (trace) trace->begin_execute();
             current_task->as_runnable_task().run(team_exec);
+            if (trace) trace->end_execute();
 
             if (team_exec.team_rank() == 0) {
               // Respawns are handled in the complete function
               queue.complete((*std::move(current_task)).as_runnable_task(),
                              team_scheduler.team_scheduler_info());
+              if (trace) trace->end_complete();
             }
           }
         }
       }
       self.disband_team();
+
+      if (trace) trace->stop();
     }  // end pragma omp parallel
   }
 
@@ -288,10 +309,17 @@ class TaskQueueSpecializationConstrained<
     auto& queue = scheduler.queue();
     queue.initialize_team_queues(pool_size / team_size);
 
+    const bool traced = TaskTracer::begin_execute(pool_size);
+
 #pragma omp parallel num_threads(pool_size)
     {
       Impl::HostThreadTeamData& self = *(instance->get_thread_data());
 
+      TaskTraceWorker* const trace =
+          traced ? TaskTracer::worker(self.pool_rank()) : nullptr;
+
+      if (trace) trace->start();
+
       // Organizing threads into a team performs a barrier across the
       // entire pool to insure proper initialization of the team
       // rendezvous mechanism before a team rendezvous can be performed.
@@ -319,6 +347,7 @@ class TaskQueueSpecializationConstrained<
                 // team member #0 completes the previously executed task,
                 // completion may delete the task
                 team_queue.complete(task);
+                if (trace) trace->end_complete();
               }
 
               // If 0 == m_ready_count then set task = 0
@@ -338,6 +367,10 @@ class TaskQueueSpecializationConstrained<
                 // count of 0 also. Otherwise, returns a task from another queue
                 // or `end` if one couldn't be popped
                 task = team_queue.attempt_to_steal_task();
+                if (trace) {
+                  trace->count_steal(task != no_more_tasks_sentinel &&
+                                     task != end);
+                }
 #if 0
                 if(task != no_more_tasks_sentinel && task != end) {
                   std::printf("task stolen on rank %d\n", team_exec.league_rank());
@@ -345,6 +378,8 @@ class TaskQueueSpecializationConstrained<
 #endif
               }
 
+              if (trace) trace->count_pop();
+
               // If still tasks are still executing
               // and no task could be acquired
               // then continue this leader loop
@@ -357,8 +392,15 @@ class TaskQueueSpecializationConstrained<
                          (task_base_type::TaskSingle == task->m_task_type)) {
                 // if a single thread task then execute now
 
+                if (trace) {
+                  trace->begin_execute();
+                  trace->sample_depth(team_queue.m_ready_count);
+                }
+
                 (*task->m_apply)(task, &single_exec);
 
+                if (trace) trace->end_execute();
+
                 leader_loop = true;
               } else {
                 leader_loop = false;
@@ -373,13 +415,19 @@ class TaskQueueSpecializationConstrained<
 
           if (task != no_more_tasks_sentinel) {  // Thread Team Task
 
+            if (trace) trace->begin_execute();
+
             (*task->m_apply)(task, &team_exec);
 
+            if (trace) trace->end_execute();
+
             // The m_apply function performs a barrier
           }
         } while (task != no_more_tasks_sentinel);
       }
       self.disband_team();
+
+      if (trace) trace->stop();
     }  // end pragma omp parallel
   }
 
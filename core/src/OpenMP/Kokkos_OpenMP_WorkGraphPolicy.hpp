@@ -56,6 +56,7 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 
   Policy m_policy;
   FunctorType m_functor;
+  Kokkos::Impl::WorkGraphHostQueues<Policy> m_queues;
 
   template <class TagType>
   typename std::enable_if<std::is_same<TagType, void>::value>::type exec_one(
@@ -78,21 +79,22 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 #pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
 #endif
     {
-      // Spin until COMPLETED_TOKEN.
-      // END_TOKEN indicates no work is currently available.
-
-      for (std::int32_t w = Policy::END_TOKEN;
-           Policy::COMPLETED_TOKEN != (w = m_policy.pop_work());) {
-        if (Policy::END_TOKEN != w) {
-          exec_one<typename Policy::work_tag>(w);
-          m_policy.completed_work(w);
-        }
-      }
+      m_queues.execute(omp_get_thread_num(), [&](const std::int32_t w) {
+        exec_one<typename Policy::work_tag>(w);
+      });
     }
   }
 
   inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
-      : m_policy(arg_policy), m_functor(arg_functor) {}
+      : m_policy(arg_policy),
+        m_functor(arg_functor),
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+        m_queues(arg_policy, OpenMP::thread_pool_size()) {
+  }
+#else
+        m_queues(arg_policy, OpenMP::impl_thread_pool_size()) {
+  }
+#endif
 };
 
 }  // namespace Impl
@@ -56,12 +56,16 @@
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
 namespace Kokkos {
 namespace Impl {
+
+__thread int t_threads_pool_rank = -1;
+
 namespace {
 
 ThreadsExec s_threads_process;
@@ -77,6 +81,11 @@ unsigned s_current_shared_size = 0;
 void (*volatile s_current_function)(ThreadsExec &, const void *);
 const void *volatile s_current_function_arg = nullptr;
 
+// Idle threads spin for a while and then block on this dispatch epoch,
+// which is advanced whenever threads are activated with blocked threads.
+int volatile s_threads_dispatch = 0;
+int volatile s_threads_blocked  = 0;
+
 struct Sentinel {
   ~Sentinel() {
     if (s_thread_pool_size[0] || s_thread_pool_size[1] ||
@@ -99,6 +108,36 @@ inline unsigned fan_size(const unsigned rank, const unsigned size) {
   return count;
 }
 
+// Wait for an inactive thread to be activated or terminated.
+void wait_dispatch(int volatile &state) {
+  const auto dispatched = [&state]() {
+    return ThreadsExec::Inactive != state;
+  };
+
+  if (host_thread_spin(dispatched)) return;
+
+  // Announcing the blocked thread before checking its state pairs with
+  // the dispatch setting the state before checking for blocked threads.
+  while (!dispatched()) {
+    const int epoch = s_threads_dispatch;
+    atomic_increment(&s_threads_blocked);
+    if (!dispatched()) {
+      host_thread_block(&s_threads_dispatch, epoch);
+    }
+    atomic_decrement(&s_threads_blocked);
+  }
+}
+
+// Wake blocked threads after their states have been changed.
+void notify_dispatch() {
+  memory_fence();
+
+  if (0 < s_threads_blocked) {
+    atomic_increment(&s_threads_dispatch);
+    host_thread_wake_all(&s_threads_dispatch);
+  }
+}
+
 }  // namespace
 }  // namespace Impl
 }  // namespace Kokkos
@@ -122,7 +161,7 @@ void ThreadsExec::driver(void) {
     // Deactivate thread and wait for reactivation
     this_thread.m_pool_state = ThreadsExec::Inactive;
 
-    wait_yield(this_thread.m_pool_state, ThreadsExec::Inactive);
+    wait_dispatch(this_thread.m_pool_state);
   }
 }
 
@@ -165,6 +204,7 @@ ThreadsExec::ThreadsExec()
       m_pool_state     = ThreadsExec::Active;
 
       s_threads_pid[m_pool_rank] = pthread_self();
+      t_threads_pool_rank        = m_pool_rank;
 
       // Inform spawning process that the threads_exec entry has been set.
       s_threads_process.m_pool_state = ThreadsExec::Active;
@@ -326,6 +366,8 @@ void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
     s_threads_exec[i]->m_pool_state = ThreadsExec::Active;
   }
 
+  notify_dispatch();
+
   if (s_threads_process.m_pool_size) {
     // Master process is the root thread, run it:
     (*func)(s_threads_process, arg);
@@ -351,6 +393,8 @@ bool ThreadsExec::sleep() {
     s_threads_exec[--i]->m_pool_state = ThreadsExec::Active;
   }
 
+  notify_dispatch();
+
   return true;
 }
 
@@ -387,6 +431,8 @@ void ThreadsExec::execute_serial(void (*func)(ThreadsExec &, const void *)) {
 
     th.m_pool_state = ThreadsExec::Active;
 
+    notify_dispatch();
+
     wait_yield(th.m_pool_state, ThreadsExec::Active);
   }
 
@@ -657,11 +703,13 @@ void ThreadsExec::initialize(unsigned thread_count, unsigned use_numa_count,
         s_threads_process.m_pool_fan_size = fan_size(
             s_threads_process.m_pool_rank, s_threads_process.m_pool_size);
         s_threads_pid[s_threads_process.m_pool_rank] = pthread_self();
+        t_threads_pool_rank = s_threads_process.m_pool_rank;
       } else {
         s_threads_process.m_pool_base     = nullptr;
         s_threads_process.m_pool_rank     = 0;
         s_threads_process.m_pool_size     = 0;
         s_threads_process.m_pool_fan_size = 0;
+        t_threads_pool_rank               = -1;
       }
 
       // Initial allocations:
@@ -729,6 +777,8 @@ void ThreadsExec::finalize() {
     if (s_threads_exec[i]) {
       s_threads_exec[i]->m_pool_state = ThreadsExec::Terminating;
 
+      notify_dispatch();
+
       wait_yield(s_threads_process.m_pool_state, ThreadsExec::Inactive);
 
       s_threads_process.m_pool_state = ThreadsExec::Inactive;
@@ -750,6 +800,8 @@ void ThreadsExec::finalize() {
   s_thread_pool_size[1] = 0;
   s_thread_pool_size[2] = 0;
 
+  t_threads_pool_rank = -1;
+
   // Reset master thread to run solo.
   s_threads_process.m_numa_rank      = 0;
   s_threads_process.m_numa_core_rank = 0;
@@ -811,6 +863,8 @@ int Threads::thread_pool_rank()
 int Threads::impl_thread_pool_rank()
 #endif
 {
+  if (0 <= Impl::t_threads_pool_rank) return Impl::t_threads_pool_rank;
+
   const pthread_t pid = pthread_self();
   int i               = 0;
   while ((i < Impl::s_thread_pool_size[0]) && (pid != Impl::s_threads_pid[i])) {
@@ -62,6 +62,9 @@
 namespace Kokkos {
 namespace Impl {
 
+// Pool rank of a thread of the Threads pool, -1 for any other thread.
+extern __thread int t_threads_pool_rank;
+
 class ThreadsExec {
  public:
   // Fan array has log_2(NT) reduction threads plus 2 scan threads
@@ -670,6 +673,9 @@ namespace Experimental {
 
 template <>
 class UniqueToken<Threads, UniqueTokenScope::Instance> {
+ private:
+  int m_size;
+
  public:
   using execution_space = Threads;
   using size_type       = int;
@@ -677,80 +683,44 @@ class UniqueToken<Threads, UniqueTokenScope::Instance> {
   /// \brief create object size for concurrency on the given instance
   ///
   /// This object should not be shared between instances
-  UniqueToken(execution_space const & = execution_space()) noexcept {}
-
-  /// \brief upper bound for acquired values, i.e. 0 <= value < size()
-  inline
+  UniqueToken(execution_space const & = execution_space()) noexcept
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-      int
-      size() const noexcept {
-    return Threads::thread_pool_size();
+      : m_size(Threads::thread_pool_size()) {
   }
 #else
-      int
-      size() const noexcept {
-    return Threads::impl_thread_pool_size();
+      : m_size(Threads::impl_thread_pool_size()) {
   }
 #endif
 
+  /// \brief upper bound for acquired values, i.e. 0 <= value < size()
+  inline int size() const noexcept { return m_size; }
+
   /// \brief acquire value such that 0 <= value < size()
-  inline
+  ///
+  /// Pool threads know their rank, only a foreign thread has to search.
+  inline int acquire() const noexcept {
+    return 0 <= Kokkos::Impl::t_threads_pool_rank
+               ? Kokkos::Impl::t_threads_pool_rank
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-      int
-      acquire() const noexcept {
-    return Threads::thread_pool_rank();
-  }
+               : Threads::thread_pool_rank();
 #else
-      int
-      acquire() const noexcept {
-    return Threads::impl_thread_pool_rank();
-  }
+               : Threads::impl_thread_pool_rank();
 #endif
+  }
 
   /// \brief release a value acquired by generate
   inline void release(int) const noexcept {}
 };
 
 template <>
-class UniqueToken<Threads, UniqueTokenScope::Global> {
+class UniqueToken<Threads, UniqueTokenScope::Global>
+    : public UniqueToken<Threads, UniqueTokenScope::Instance> {
  public:
-  using execution_space = Threads;
-  using size_type       = int;
-
   /// \brief create object size for concurrency on the given instance
   ///
-  /// This object should not be shared between instances
-  UniqueToken(execution_space const & = execution_space()) noexcept {}
-
-  /// \brief upper bound for acquired values, i.e. 0 <= value < size()
-  inline
-#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-      int
-      size() const noexcept {
-    return Threads::thread_pool_size();
-  }
-#else
-      int
-      size() const noexcept {
-    return Threads::impl_thread_pool_size();
-  }
-#endif
-
-  /// \brief acquire value such that 0 <= value < size()
-  inline
-#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-      int
-      acquire() const noexcept {
-    return Threads::thread_pool_rank();
-  }
-#else
-      int
-      acquire() const noexcept {
-    return Threads::impl_thread_pool_rank();
-  }
-#endif
-  /// \brief release a value acquired by generate
-  inline void release(int) const noexcept {}
+  /// There is a single Threads pool, hence a single set of tokens
+  UniqueToken(execution_space const &arg = execution_space()) noexcept
+      : UniqueToken<Threads, UniqueTokenScope::Instance>(arg) {}
 };
 
 }  // namespace Experimental
@@ -1131,11 +1131,9 @@ KOKKOS_INLINE_FUNCTION
     parallel_reduce(const Impl::ThreadVectorRangeBoundariesStruct<
                         iType, Impl::ThreadsExecTeamMember>& loop_boundaries,
                     const Lambda& lambda, ValueType& result) {
-  result = ValueType();
-  for (iType i = loop_boundaries.start; i < loop_boundaries.end;
-       i += loop_boundaries.increment) {
-    lambda(i, result);
-  }
+  Impl::host_thread_vector_reduce(
+      loop_boundaries.start, loop_boundaries.end, lambda,
+      Impl::HostThreadVectorSum<ValueType>(), result);
 }
 
 template <typename iType, class Lambda, typename ReducerType>
@@ -1144,11 +1142,8 @@ KOKKOS_INLINE_FUNCTION
     parallel_reduce(const Impl::ThreadVectorRangeBoundariesStruct<
                         iType, Impl::ThreadsExecTeamMember>& loop_boundaries,
                     const Lambda& lambda, const ReducerType& reducer) {
-  reducer.init(reducer.reference());
-  for (iType i = loop_boundaries.start; i < loop_boundaries.end;
-       i += loop_boundaries.increment) {
-    lambda(i, reducer.reference());
-  }
+  Impl::host_thread_vector_reduce(loop_boundaries.start, loop_boundaries.end,
+                                  lambda, reducer, reducer.reference());
 }
 
 /** \brief  Intra-thread vector parallel exclusive prefix sum. Executes
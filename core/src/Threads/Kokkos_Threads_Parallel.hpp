@@ -56,6 +56,7 @@
 #include <impl/Kokkos_FunctorAdapter.hpp>
 
 #include <KokkosExp_MDRangePolicy.hpp>
+#include <impl/Kokkos_HostMDRangeTuner.hpp>
 
 //----------------------------------------------------------------------------
 
@@ -127,7 +128,7 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
 
   template <class Schedule>
   static typename std::enable_if<
-      std::is_same<Schedule, Kokkos::Dynamic>::value>::type
+      !std::is_same<Schedule, Kokkos::Static>::value>::type
   exec_schedule(ThreadsExec &exec, const void *arg) {
     const ParallelFor &self = *((const ParallelFor *)arg);
 
@@ -220,7 +221,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
 
   template <class Schedule>
   static typename std::enable_if<
-      std::is_same<Schedule, Kokkos::Dynamic>::value>::type
+      !std::is_same<Schedule, Kokkos::Static>::value>::type
   exec_schedule(ThreadsExec &exec, const void *arg) {
     const ParallelFor &self = *((const ParallelFor *)arg);
 
@@ -249,8 +250,15 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::start(&ParallelFor::exec, this);
-    ThreadsExec::fence();
+    if (m_mdr_policy.m_tune_tiles && HostMDRangeTuner::is_enabled()) {
+      // The tuned policy has explicit tiles and so is not tuned again
+      HostMDRangeTunedLaunch<MDRangePolicy> launch(m_mdr_policy, m_functor,
+                                                   Threads::concurrency());
+      ParallelFor(m_functor, launch.policy()).execute();
+    } else {
+      ThreadsExec::start(&ParallelFor::exec, this);
+      ThreadsExec::fence();
+    }
   }
 
   ParallelFor(const FunctorType &arg_functor, const MDRangePolicy &arg_policy)
@@ -299,7 +307,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
   template <class TagType, class Schedule>
   inline static typename std::enable_if<
       std::is_same<TagType, void>::value &&
-      std::is_same<Schedule, Kokkos::Dynamic>::value>::type
+      !std::is_same<Schedule, Kokkos::Static>::value>::type
   exec_team(const FunctorType &functor, Member member) {
     for (; member.valid_dynamic(); member.next_dynamic()) {
       functor(member);
@@ -309,7 +317,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
   template <class TagType, class Schedule>
   inline static typename std::enable_if<
       !std::is_same<TagType, void>::value &&
-      std::is_same<Schedule, Kokkos::Dynamic>::value>::type
+      !std::is_same<Schedule, Kokkos::Static>::value>::type
   exec_team(const FunctorType &functor, Member member) {
     const TagType t{};
     for (; member.valid_dynamic(); member.next_dynamic()) {
@@ -431,7 +439,7 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
 
   template <class Schedule>
   static typename std::enable_if<
-      std::is_same<Schedule, Kokkos::Dynamic>::value>::type
+      !std::is_same<Schedule, Kokkos::Static>::value>::type
   exec_schedule(ThreadsExec &exec, const void *arg) {
     const ParallelReduce &self = *((const ParallelReduce *)arg);
     const WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
@@ -592,7 +600,7 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
 
   template <class Schedule>
   static typename std::enable_if<
-      std::is_same<Schedule, Kokkos::Dynamic>::value>::type
+      !std::is_same<Schedule, Kokkos::Static>::value>::type
   exec_schedule(ThreadsExec &exec, const void *arg) {
     const ParallelReduce &self = *((const ParallelReduce *)arg);
     const WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
@@ -60,6 +60,7 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 
   Policy m_policy;
   FunctorType m_functor;
+  Kokkos::Impl::WorkGraphHostQueues<Policy> m_queues;
 
   template <class TagType>
   typename std::enable_if<std::is_same<TagType, void>::value>::type exec_one(
@@ -74,22 +75,15 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
     m_functor(t, w);
   }
 
-  inline void exec_one_thread() const noexcept {
-    // Spin until COMPLETED_TOKEN.
-    // END_TOKEN indicates no work is currently available.
-
-    for (std::int32_t w = Policy::END_TOKEN;
-         Policy::COMPLETED_TOKEN != (w = m_policy.pop_work());) {
-      if (Policy::END_TOKEN != w) {
-        exec_one<typename Policy::work_tag>(w);
-        m_policy.completed_work(w);
-      }
-    }
+  inline void exec_one_thread(const int rank) const noexcept {
+    m_queues.execute(rank, [&](const std::int32_t w) {
+      exec_one<typename Policy::work_tag>(w);
+    });
   }
 
   static inline void thread_main(ThreadsExec& exec, const void* arg) noexcept {
     const Self& self = *(static_cast<const Self*>(arg));
-    self.exec_one_thread();
+    self.exec_one_thread(exec.pool_rank());
     exec.fan_in();
   }
 
@@ -100,7 +94,15 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
   }
 
   inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
-      : m_policy(arg_policy), m_functor(arg_functor) {}
+      : m_policy(arg_policy),
+        m_functor(arg_functor),
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+        m_queues(arg_policy, Threads::thread_pool_size()) {
+  }
+#else
+        m_queues(arg_policy, Threads::impl_thread_pool_size()) {
+  }
+#endif
 };
 
 }  // namespace Impl
@@ -1520,6 +1520,139 @@ struct Tile_Loop_Type<
 };
 // end Structs for calling loops
 
+// Space-filling curve tile orders.
+// Hilbert curve state transitions follow C. H. Hamilton, "Compact Hilbert
+// Indices", Dalhousie University Technical Report CS-2006-07.
+
+template <int Rank>
+inline unsigned host_curve_rotl(const unsigned b, const int r) {
+  enum { mask = (1u << Rank) - 1 };
+  return r % Rank == 0 ? b
+                       : ((b << (r % Rank)) | (b >> (Rank - r % Rank))) & mask;
+}
+
+// Number of trailing set bits
+inline int host_curve_tsb(unsigned w) {
+  int n = 0;
+  for (; w & 1u; w >>= 1) ++n;
+  return n;
+}
+
+// Entry corner of the w-th sub-cube
+inline unsigned host_curve_hilbert_entry(const unsigned w) {
+  const unsigned v = w == 0 ? 0 : 2 * ((w - 1) / 2);
+  return v ^ (v >> 1);
+}
+
+// Intra sub-cube direction of the w-th sub-cube
+template <int Rank>
+inline int host_curve_hilbert_direction(const unsigned w) {
+  return w == 0 ? 0
+                : (w & 1u) ? host_curve_tsb(w) % Rank
+                           : host_curve_tsb(w - 1) % Rank;
+}
+
+/** \brief  Tile of the 'idx'-th position along a Morton or Hilbert curve
+ *          through a grid of 'tile_end' tiles.
+ *
+ *  The curve is defined on the smallest power-of-two cube enclosing the
+ *  grid.  Tiles outside of the grid are skipped by counting the grid tiles
+ *  in each sub-cube while descending the curve, so every index in
+ *  [0, number of tiles) maps to a distinct tile.  Bit zero of a sub-cube
+ *  label is the fastest striding dimension.
+ */
+template <int Rank, typename Point>
+inline void host_curve_tile(Point const& tile_end, const bool hilbert,
+                            const bool inner_left, int64_t idx, Point& tile) {
+  enum { children = 1u << Rank };
+
+  int levels = 0;
+  for (int j = 0; j < Rank; ++j) {
+    tile[j] = 0;
+    while ((int64_t(1) << levels) < int64_t(tile_end[j])) ++levels;
+  }
+
+  unsigned entry = 0;
+  int dir        = 0;
+
+  for (int level = levels - 1; 0 <= level; --level) {
+    const int64_t half = int64_t(1) << level;
+
+    for (unsigned w = 0; w < children; ++w) {
+      const unsigned label =
+          hilbert ? host_curve_rotl<Rank>(w ^ (w >> 1), dir + 1) ^ entry : w;
+
+      int64_t count = 1;
+      for (int b = 0; b < Rank && 0 < count; ++b) {
+        const int j       = inner_left ? b : Rank - 1 - b;
+        const int64_t lo  = tile[j] + (((label >> b) & 1u) ? half : 0);
+        const int64_t end = int64_t(tile_end[j]);
+        count *= lo < end ? (lo + half < end ? half : end - lo) : 0;
+      }
+
+      if (idx < count) {
+        for (int b = 0; b < Rank; ++b) {
+          if ((label >> b) & 1u) tile[inner_left ? b : Rank - 1 - b] += half;
+        }
+        if (hilbert) {
+          entry ^= host_curve_rotl<Rank>(host_curve_hilbert_entry(w), dir + 1);
+          dir = (dir + host_curve_hilbert_direction<Rank>(w) + 1) % Rank;
+        }
+        break;
+      }
+      idx -= count;
+    }
+  }
+}
+
+/** \brief  Extents of a full tile of an MDRangePolicy: the compile-time
+ *          TileSize of its iteration pattern if one is given, otherwise the
+ *          runtime tile.
+ */
+template <typename RP,
+          typename TileSize = typename RP::iteration_pattern::tile_size>
+struct HostFullTile {
+  typedef TileSize type;
+  static constexpr type get(RP const&) { return type(); }
+};
+
+template <typename RP>
+struct HostFullTile<RP, void> {
+  typedef typename RP::tile_type type;
+  static type const& get(RP const& rp) { return rp.m_tile; }
+};
+
+/** \brief  Offset of the 'tile_idx'-th tile of an MDRangePolicy.
+ *
+ *  Left and Right outer directions order tiles lexicographically.  Morton
+ *  and Hilbert outer directions order tiles along a space-filling curve, so
+ *  a contiguous range of tile indices, as assigned to a thread by static or
+ *  dynamic scheduling, covers a compact block of neighbouring tiles.
+ */
+template <typename RP, typename IType>
+inline void host_tile_offset(RP const& rp, IType tile_idx,
+                             typename RP::point_type& offset) {
+  if (RP::outer_direction == RP::Left) {
+    for (int i = 0; i < RP::rank; ++i) {
+      offset[i] = (tile_idx % rp.m_tile_end[i]) * rp.m_tile[i] + rp.m_lower[i];
+      tile_idx /= rp.m_tile_end[i];
+    }
+  } else if (RP::outer_direction == RP::Right) {
+    for (int i = RP::rank - 1; i >= 0; --i) {
+      offset[i] = (tile_idx % rp.m_tile_end[i]) * rp.m_tile[i] + rp.m_lower[i];
+      tile_idx /= rp.m_tile_end[i];
+    }
+  } else {
+    typename RP::point_type tile;
+    host_curve_tile<RP::rank>(rp.m_tile_end, RP::outer_direction == RP::Hilbert,
+                              RP::inner_direction == RP::Left,
+                              static_cast<int64_t>(tile_idx), tile);
+    for (int i = 0; i < RP::rank; ++i) {
+      offset[i] = tile[i] * rp.m_tile[i] + rp.m_lower[i];
+    }
+  }
+}
+
 template <typename T>
 using is_void_type = std::is_same<T, void>;
 
@@ -1584,27 +1717,24 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    typedef Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left),
+                           index_type, Tag>
+        loop_type;
+
+    // Full tiles are a separate instantiation of the loop nest so that a
+    // compile-time tile size yields constant trip counts
+    if (full_tile) {
+      loop_type::apply(m_func, true, m_offset, HostFullTile<RP>::get(m_rp),
+                       HostFullTile<RP>::get(m_rp));
+    } else {
+      loop_type::apply(m_func, false, m_offset, m_rp.m_tile, m_tiledims);
+    }
   }
 
 #else
@@ -1620,19 +1750,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1664,19 +1782,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1708,19 +1814,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1752,19 +1846,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1796,19 +1878,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1840,19 +1910,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1884,19 +1942,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2005,27 +2051,26 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    typedef Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left),
+                           index_type, Tag>
+        loop_type;
+
+    // Full tiles are a separate instantiation of the loop nest so that a
+    // compile-time tile size yields constant trip counts
+    if (full_tile) {
+      loop_type::apply(m_v, m_func, true, m_offset,
+                       HostFullTile<RP>::get(m_rp),
+                       HostFullTile<RP>::get(m_rp));
+    } else {
+      loop_type::apply(m_v, m_func, false, m_offset, m_rp.m_tile,
+                       m_tiledims);
+    }
   }
 
 #else
@@ -2041,19 +2086,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2085,19 +2118,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2129,19 +2150,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2173,19 +2182,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2217,19 +2214,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2261,19 +2246,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2305,19 +2278,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2428,27 +2389,26 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    typedef Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left),
+                           index_type, Tag>
+        loop_type;
+
+    // Full tiles are a separate instantiation of the loop nest so that a
+    // compile-time tile size yields constant trip counts
+    if (full_tile) {
+      loop_type::apply(m_v, m_func, true, m_offset,
+                       HostFullTile<RP>::get(m_rp),
+                       HostFullTile<RP>::get(m_rp));
+    } else {
+      loop_type::apply(m_v, m_func, false, m_offset, m_rp.m_tile,
+                       m_tiledims);
+    }
   }
 
 #else
@@ -2464,19 +2424,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2508,19 +2456,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2552,19 +2488,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2596,19 +2520,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2640,19 +2552,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2684,19 +2584,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2728,19 +2616,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    host_tile_offset(m_rp, tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -97,6 +97,68 @@ struct concurrent_bitset {
                : 0;
   }
 
+  //  Summarized buffer is uint32_t[ summary_buffer_bound ]
+  //    [ uint32_t { state_header | used_count } , uint32_t bits[*] ,
+  //      uint32_t summary[*] ]
+  //
+  //  Summary bit 'w' is set when bits word 'w' has been observed full,
+  //  so that acquire jumps over full words instead of racing through
+  //  them.  The summary is a hint maintained without locks: a stale
+  //  flag may cost a wasted attempt but never a lost bit.
+  //
+  //  A buffer whose bit bound changes while it is empty, as a MemoryPool
+  //  superblock does, is laid out for its largest 'layout_bound' so that
+  //  a stale flag never lands in the bits of a larger bound.
+
+  /**\brief  Number of words to hold 'bit_bound' bits */
+  KOKKOS_INLINE_FUNCTION static constexpr uint32_t word_bound(
+      uint32_t const bit_bound) noexcept {
+    return (bit_bound + bits_per_int_mask) >> bits_per_int_lg2;
+  }
+
+  /**\brief  Initialize summarized bitset buffer */
+  KOKKOS_INLINE_FUNCTION static constexpr uint32_t summary_buffer_bound(
+      uint32_t const bit_bound) noexcept {
+    return bit_bound <= max_bit_count
+               ? 1 + word_bound(bit_bound) + word_bound(word_bound(bit_bound))
+               : 0;
+  }
+
+  /**\brief  Mask of the bits of 'word' which are below 'bit_bound' */
+  KOKKOS_INLINE_FUNCTION static constexpr uint32_t word_mask(
+      uint32_t const bit_bound, uint32_t const word) noexcept {
+    return ((word + 1) << bits_per_int_lg2) <= bit_bound
+               ? ~0u
+               : (1u << (bit_bound & bits_per_int_mask)) - 1;
+  }
+
+  /**\brief  First word after 'word', cyclically, which is not flagged
+   *         as full by the summary.  Returns 'word_count' if all are.
+   */
+  KOKKOS_INLINE_FUNCTION static uint32_t summary_next_word(
+      uint32_t volatile *const summary, uint32_t const word,
+      uint32_t const word_count) noexcept {
+    const uint32_t summary_count = word_bound(word_count);
+
+    uint32_t next = word + 1 < word_count ? word + 1 : 0;
+
+    // Visit each summary word once, the first one twice when wrapping
+    for (uint32_t n = 0; n <= summary_count; ++n) {
+      const uint32_t k    = next >> bits_per_int_lg2;
+      const uint32_t open = ~summary[k] & word_mask(word_count, k) &
+                            (~0u << (next & bits_per_int_mask));
+
+      if (open) {
+        return (k << bits_per_int_lg2) |
+               uint32_t(Kokkos::Impl::bit_scan_forward(open));
+      }
+
+      next = k + 1 < summary_count ? (k + 1) << bits_per_int_lg2 : 0;
+    }
+
+    return word_count;
+  }
+
   /**\brief  Claim any bit within the bitset bound.
    *
    *  Return : ( which_bit , bit_count )
@@ -268,6 +330,95 @@ struct concurrent_bitset {
     }
   }
 
+  /**\brief  Claim any bit within the bound of a summarized bitset.
+   *
+   *  Requires: buffer of summary_buffer_bound( layout_bound ) words,
+   *            where layout_bound defaults to bit_bound, and released
+   *            only through release_summary with the same bounds.
+   *
+   *  Return and recommended hint as for acquire_bounded.
+   */
+  KOKKOS_INLINE_FUNCTION static Kokkos::pair<int, int> acquire_summary_bounded(
+      uint32_t volatile *const buffer, uint32_t const bit_bound,
+      uint32_t bit = 0 /* optional hint */
+      ,
+      uint32_t const state_header = 0 /* optional header */
+      ,
+      uint32_t const layout_bound = 0 /* optional layout */
+      ) noexcept {
+    typedef Kokkos::pair<int, int> type;
+
+    if ((max_bit_count < bit_bound) || (state_header & ~state_header_mask) ||
+        (bit_bound <= bit) || (layout_bound && layout_bound < bit_bound)) {
+      return type(-3, -3);
+    }
+
+    const uint32_t word_count = word_bound(bit_bound);
+
+    uint32_t volatile *const summary =
+        buffer + 1 + word_bound(layout_bound ? layout_bound : bit_bound);
+
+    const uint32_t state =
+        (uint32_t)Kokkos::atomic_fetch_add((volatile int *)buffer, 1);
+
+    const uint32_t state_error = state_header != (state & state_header_mask);
+
+    const uint32_t state_bit_used = state & state_used_mask;
+
+    if (state_error || (bit_bound <= state_bit_used)) {
+      Kokkos::atomic_fetch_add((volatile int *)buffer, -1);
+      return state_error ? type(-2, -2) : type(-1, -1);
+    }
+
+    // Do not update bit until count is visible:
+
+    Kokkos::memory_fence();
+
+    while (1) {
+      const uint32_t word = bit >> bits_per_int_lg2;
+      const uint32_t mask = 1u << (bit & bits_per_int_mask);
+      const uint32_t out  = ~word_mask(bit_bound, word);
+      const uint32_t flag = 1u << (word & bits_per_int_mask);
+      const uint32_t prev = Kokkos::atomic_fetch_or(buffer + word + 1, mask);
+
+      // Keep the summary flag of the visited word up to date
+
+      uint32_t volatile *const summary_word =
+          summary + (word >> bits_per_int_lg2);
+
+      const bool is_full      = ~0u == (prev | mask | out);
+      const bool summary_full = *summary_word & flag;
+
+      if (is_full && !summary_full) {
+        Kokkos::atomic_fetch_or(summary_word, flag);
+      } else if (!is_full && summary_full) {
+        Kokkos::atomic_fetch_and(summary_word, ~flag);
+      }
+
+      if (!(prev & mask)) {
+        return type(bit, state_bit_used + 1);
+      }
+
+      const int j = Kokkos::Impl::bit_first_zero(prev | out);
+
+      if (0 <= j) {
+        bit = (word << bits_per_int_lg2) | uint32_t(j);
+      } else {
+        // Word is full, jump to the next word which is not known to be.
+        // If every word is flagged then some flag is stale: step through
+        // the words one at a time until a free bit is found.
+
+        uint32_t next = summary_next_word(summary, word, word_count);
+
+        if (word_count == next) next = word + 1 < word_count ? word + 1 : 0;
+
+        bit = (next << bits_per_int_lg2) | (bit & bits_per_int_mask);
+
+        if (bit_bound <= bit) bit = next << bits_per_int_lg2;
+      }
+    }
+  }
+
   /**\brief
    *
    *  Requires: 'bit' previously acquired and has not yet been released.
@@ -301,6 +452,49 @@ struct concurrent_bitset {
     return (count & state_used_mask) - 1;
   }
 
+  /**\brief  Release a bit of a summarized bitset.
+   *
+   *  Requires: 'bit' previously acquired by acquire_summary_bounded
+   *            with the same 'bit_bound' and 'layout_bound' and has not
+   *            yet been released.
+   *
+   *  Returns as for release.
+   */
+  KOKKOS_INLINE_FUNCTION static int release_summary(
+      uint32_t volatile *const buffer, uint32_t const bit_bound,
+      uint32_t const bit,
+      uint32_t const state_header = 0 /* optional header */
+      ,
+      uint32_t const layout_bound = 0 /* optional layout */
+      ) noexcept {
+    if (state_header != (state_header_mask & *buffer)) {
+      return -2;
+    }
+
+    const uint32_t word = bit >> bits_per_int_lg2;
+    const uint32_t mask = 1u << (bit & bits_per_int_mask);
+    const uint32_t prev = Kokkos::atomic_fetch_and(buffer + word + 1, ~mask);
+
+    if (!(prev & mask)) {
+      return -1;
+    }
+
+    if (~0u == (prev | ~word_mask(bit_bound, word))) {
+      // Word was full and now has a free bit
+      Kokkos::atomic_fetch_and(
+          buffer + 1 + word_bound(layout_bound ? layout_bound : bit_bound) +
+              (word >> bits_per_int_lg2),
+          ~(1u << (word & bits_per_int_mask)));
+    }
+
+    // Do not update count until bit clear is visible
+    Kokkos::memory_fence();
+
+    const int count = Kokkos::atomic_fetch_add((volatile int *)buffer, -1);
+
+    return (count & state_used_mask) - 1;
+  }
+
   /**\brief
    *
    *  Requires: Bit within bounds and not already set.
@@ -44,6 +44,8 @@
 
 #include <Kokkos_Core.hpp>
 #include <impl/Kokkos_Error.hpp>
+#include <impl/Kokkos_TaskTracer.hpp>
+#include <impl/Kokkos_HostMDRangeTuner.hpp>
 #include <cctype>
 #include <cstring>
 #include <iostream>
@@ -436,6 +438,12 @@ void finalize_internal(const bool all_spaces = false) {
     ++numSuccessfulCalls;
   }
 
+#if defined(KOKKOS_ENABLE_TASKDAG)
+  Kokkos::Impl::TaskTracer::disable();
+#endif
+
+  Kokkos::Impl::HostMDRangeTuner::disable();
+
 #if defined(KOKKOS_ENABLE_PROFILING)
   Kokkos::Profiling::finalize();
 #endif
@@ -45,64 +45,35 @@
 #include <Kokkos_Macros.hpp>
 
 #include <impl/Kokkos_HostBarrier.hpp>
-#include <impl/Kokkos_BitOps.hpp>
-
-#include <impl/Kokkos_HostBarrier.hpp>
-
-#if !defined(_WIN32)
-#include <sched.h>
-#include <time.h>
-#else
-#include <process.h>
-#include <winsock2.h>
-#include <windows.h>
-#endif
+#include <impl/Kokkos_Spinwait.hpp>
 
 namespace Kokkos {
 namespace Impl {
 
 void HostBarrier::impl_backoff_wait_until_equal(
-    int* ptr, const int v, const bool active_wait) noexcept {
-#if !defined(_WIN32)
-  timespec req;
-  req.tv_sec     = 0;
-  unsigned count = 0u;
-
-  while (!test_equal(ptr, v)) {
-    const int c = ::Kokkos::log2(++count);
-    if (!active_wait || c > log2_iterations_till_sleep) {
-      req.tv_nsec = c < 16 ? 256 * c : 4096;
-      nanosleep(&req, nullptr);
-    } else if (c > log2_iterations_till_yield) {
-      sched_yield();
-    }
-#if defined(KOKKOS_ENABLE_ASM)
-#if defined(__PPC64__)
-    for (int j = 0; j < num_nops; ++j) {
-      asm volatile("nop\n");
-    }
-    asm volatile("or 27, 27, 27" ::: "memory");
-#elif defined(__amd64) || defined(__amd64__) || defined(__x86_64) || \
-    defined(__x86_64__)
-    for (int j = 0; j < num_nops; ++j) {
-      asm volatile("nop\n");
-    }
-    asm volatile("pause\n" ::: "memory");
-#endif
-#endif
+    int* ptr, const int v, int* sleepers, const bool active_wait) noexcept {
+  // Spin for a while so that back to back barriers stay cheap
+  if (active_wait && host_thread_spin([ptr, v]() {
+        return Kokkos::atomic_fetch_add(ptr, 0) == v;
+      })) {
+    Kokkos::memory_fence();
+    return;
   }
-#else  // _WIN32
+
+  // Then block until a releasing thread wakes the sleepers.
+  // Announcing the sleeper before reading the current value pairs with
+  // the releasing thread updating the value before reading the sleepers.
   while (!test_equal(ptr, v)) {
-#if defined(KOKKOS_ENABLE_ASM)
-    for (int j = 0; j < num_nops; ++j) {
-      __asm__ __volatile__("nop\n");
+    Kokkos::atomic_increment(sleepers);
+    const int current = Kokkos::atomic_fetch_add(ptr, 0);
+    if (current != v) {
+      host_thread_block(ptr, current);
     }
-    __asm__ __volatile__("pause\n" ::: "memory");
-#endif
+    Kokkos::atomic_decrement(sleepers);
   }
-#endif
-  // printf("W: %d\n", count);
 }
 
+void HostBarrier::impl_wake(int* ptr) noexcept { host_thread_wake_all(ptr); }
+
 }  // namespace Impl
 }  // namespace Kokkos
@@ -82,17 +82,18 @@ class HostBarrier {
       required_buffer_size / sizeof(int);
 
  private:
-  // fit the following 3 atomics within a 128 bytes while
+  // fit the following 4 atomics within a 128 bytes while
   // keeping the arrive atomic at least 64 bytes away from
-  // the wait atomic to reduce contention on the caches
+  // the wait atomic to reduce contention on the caches.
+  // The sleep atomic counts the threads blocked in the back-off
+  // so that releasing threads only wake them when needed.
   static constexpr int arrive_idx = 32 / sizeof(int);
   static constexpr int master_idx = 64 / sizeof(int);
   static constexpr int wait_idx   = 96 / sizeof(int);
+  static constexpr int sleep_idx  = 112 / sizeof(int);
 
-  static constexpr int num_nops                   = 32;
-  static constexpr int iterations_till_backoff    = 64;
-  static constexpr int log2_iterations_till_yield = 4;
-  static constexpr int log2_iterations_till_sleep = 6;
+  static constexpr int num_nops                = 32;
+  static constexpr int iterations_till_backoff = 64;
 
  public:
   // will return true if call is the last thread to arrive
@@ -108,6 +109,7 @@ class HostBarrier {
 
     if (master_wait && result) {
       Kokkos::atomic_fetch_add(buffer + master_idx, 1);
+      wake_sleepers(buffer, master_idx);
     }
 
     return result;
@@ -123,6 +125,7 @@ class HostBarrier {
     Kokkos::memory_fence();
     Kokkos::atomic_fetch_sub(buffer + arrive_idx, size);
     Kokkos::atomic_fetch_add(buffer + wait_idx, 1);
+    wake_sleepers(buffer, wait_idx);
   }
 
   // should only be called by the master thread, will allow the master thread to
@@ -131,7 +134,8 @@ class HostBarrier {
   static void split_master_wait(int* buffer, const int size, const int step,
                                 const bool active_wait = true) noexcept {
     if (size <= 1) return;
-    wait_until_equal(buffer + master_idx, step, active_wait);
+    wait_until_equal(buffer + master_idx, step, buffer + sleep_idx,
+                     active_wait);
   }
 
   // arrive, last thread automatically release waiting threads
@@ -155,7 +159,7 @@ class HostBarrier {
   static void wait(int* buffer, const int size, const int step,
                    bool active_wait = true) noexcept {
     if (size <= 1) return;
-    wait_until_equal(buffer + wait_idx, step, active_wait);
+    wait_until_equal(buffer + wait_idx, step, buffer + sleep_idx, active_wait);
   }
 
  public:
@@ -204,8 +208,22 @@ class HostBarrier {
     return result;
   }
 
+  // wake threads blocked in the back-off on buffer[idx], if any
   KOKKOS_INLINE_FUNCTION
-  static void wait_until_equal(int* ptr, const int v,
+  static void wake_sleepers(int* buffer, const int idx) noexcept {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    Kokkos::memory_fence();
+    if (*static_cast<int volatile*>(buffer + sleep_idx) != 0) {
+      impl_wake(buffer + idx);
+    }
+#else
+    (void)buffer;
+    (void)idx;
+#endif
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void wait_until_equal(int* ptr, const int v, int* sleepers,
                                bool active_wait = true) noexcept {
 #if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
     bool result = test_equal(ptr, v);
@@ -232,9 +250,10 @@ class HostBarrier {
       result = test_equal(ptr, v);
     }
     if (!result) {
-      impl_backoff_wait_until_equal(ptr, v, active_wait);
+      impl_backoff_wait_until_equal(ptr, v, sleepers, active_wait);
     }
 #else
+    (void)sleepers;
     (void)active_wait;
     while (!test_equal(ptr, v)) {
     }
@@ -242,8 +261,11 @@ class HostBarrier {
   }
 
   static void impl_backoff_wait_until_equal(int* ptr, const int v,
+                                            int* sleepers,
                                             const bool active_wait) noexcept;
 
+  static void impl_wake(int* ptr) noexcept;
+
  private:
   int m_size{0};
   mutable int m_step{0};
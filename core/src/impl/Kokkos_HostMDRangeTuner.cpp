@@ -0,0 +1,349 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <impl/Kokkos_HostMDRangeTuner.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+// Estimated bytes touched per iteration point when sizing a tile to a
+// cache, e.g. a stencil reading neighbors in one array and writing another.
+constexpr long tune_bytes_per_point = 32;
+
+// Contiguous points the inner tile dimension keeps in a block shape.
+constexpr long tune_min_inner_tile = 8;
+
+struct TuneEntry {
+  int rank;
+  int launches;                 // exploration launches selected so far
+  int best;                     // settled candidate, -1 while exploring
+  std::vector<long> tiles;      // rank tile dimensions per candidate
+  std::vector<double> seconds;  // fastest time per candidate, < 0 if untimed
+
+  int candidates() const { return int(seconds.size()); }
+};
+
+// The enabled flag is read without the mutex on every default tiled
+// launch, the remaining state is only accessed with the mutex held.
+struct HostMDRangeTunerState {
+  std::atomic<bool> enabled;
+  std::once_flag environment_once;
+  bool file_loaded;
+  int exploration;
+  std::string filename;
+  std::map<std::string, TuneEntry> entries;
+  std::mutex mutex;
+
+  HostMDRangeTunerState()
+      : enabled(false),
+        environment_once(),
+        file_loaded(false),
+        exploration(0),
+        filename(),
+        entries(),
+        mutex() {}
+};
+
+// Requires state.mutex to be held.
+void enable_tuning(HostMDRangeTunerState& state, int exploration_launches,
+                   std::string const& filename) {
+  state.exploration = exploration_launches;
+  if (state.filename != filename) state.file_loaded = false;
+  state.filename = filename;
+  state.enabled.store(true, std::memory_order_release);
+}
+
+void check_environment(HostMDRangeTunerState& state) {
+  char const* const env  = std::getenv("KOKKOS_MDRANGE_AUTOTUNE");
+  char const* const file = std::getenv("KOKKOS_MDRANGE_TUNE_FILE");
+  if (env != nullptr && 0 < std::atoi(env)) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    enable_tuning(state, std::atoi(env),
+                  file != nullptr ? file : std::string());
+  }
+}
+
+// The environment is read once, before any explicit enable or disable,
+// so that those override it.
+HostMDRangeTunerState& tuner_state() {
+  static HostMDRangeTunerState state;
+  std::call_once(state.environment_once, check_environment, std::ref(state));
+  return state;
+}
+
+void load_file(HostMDRangeTunerState& state) {
+  if (state.file_loaded || state.filename.empty()) return;
+  state.file_loaded = true;
+
+  // A missing file is expected on the first run.
+  std::ifstream in(state.filename.c_str());
+  std::string key;
+  int rank = 0;
+
+  while (in >> key >> rank) {
+    if (rank < 1 || HostMDRangeTuner::max_rank < rank) break;
+    TuneEntry e;
+    e.rank     = rank;
+    e.launches = 0;
+    e.best     = 0;
+    e.tiles.resize(rank);
+    e.seconds.assign(1, 0.0);
+    for (int i = 0; i < rank; ++i) in >> e.tiles[i];
+    if (!in) break;
+    state.entries[key] = e;
+  }
+}
+
+void settle(TuneEntry& e) {
+  e.best = 0;
+  for (int c = 0; c < e.candidates(); ++c) {
+    if (0 <= e.seconds[c] &&
+        (e.seconds[e.best] < 0 || e.seconds[c] < e.seconds[e.best])) {
+      e.best = c;
+    }
+  }
+}
+
+// Fill the budget of points with the longest possible inner extent.
+void shape_pencil(int rank, bool inner_right, const long span[], long budget,
+                  long tile[]) {
+  for (int n = 0; n < rank; ++n) {
+    const int i = inner_right ? rank - 1 - n : n;
+    tile[i]     = std::max(1L, std::min(span[i], budget));
+    budget /= tile[i];
+  }
+}
+
+// Fill the budget of points with a tile as close to a cube as the inner
+// extent allows.
+void shape_block(int rank, bool inner_right, const long span[], long budget,
+                 long tile[]) {
+  for (int n = 0; n < rank; ++n) {
+    const int i = inner_right ? rank - 1 - n : n;
+    long edge = std::lround(std::pow(double(budget), 1.0 / double(rank - n)));
+    if (0 == n) edge = std::max(edge, tune_min_inner_tile);
+    tile[i] = std::max(1L, std::min(span[i], edge));
+    budget /= tile[i];
+  }
+}
+
+TuneEntry make_entry(int rank, bool inner_right, const long span[],
+                     const long default_tile[], int concurrency) {
+  TuneEntry e;
+  e.rank     = rank;
+  e.launches = 0;
+  e.best     = -1;
+  e.tiles.assign(default_tile, default_tile + rank);
+
+  std::size_t l1 = 0, l2 = 0;
+  HostMDRangeTuner::cache_sizes(l1, l2);
+
+  const long budget[2] = {long(l1) / tune_bytes_per_point,
+                          long(l2) / tune_bytes_per_point};
+
+  for (int b = 0; b < 2; ++b) {
+    for (int shape = 0; shape < 2; ++shape) {
+      long tile[HostMDRangeTuner::max_rank];
+      if (shape == 0) {
+        shape_pencil(rank, inner_right, span, budget[b], tile);
+      } else {
+        shape_block(rank, inner_right, span, budget[b], tile);
+      }
+
+      // Candidates must leave a tile for every thread.
+      long num_tiles = 1;
+      for (int i = 0; i < rank; ++i) {
+        num_tiles *= (span[i] + tile[i] - 1) / tile[i];
+      }
+
+      bool unique = true;
+      for (std::size_t c = 0; c < e.tiles.size() && unique; c += rank) {
+        unique = !std::equal(tile, tile + rank, e.tiles.begin() + c);
+      }
+
+      if (unique && concurrency <= num_tiles) {
+        e.tiles.insert(e.tiles.end(), tile, tile + rank);
+      }
+    }
+  }
+
+  e.seconds.assign(e.tiles.size() / rank, -1.0);
+  return e;
+}
+
+}  // namespace
+
+bool HostMDRangeTuner::is_enabled() {
+  return tuner_state().enabled.load(std::memory_order_acquire);
+}
+
+void HostMDRangeTuner::enable(int exploration_launches,
+                              std::string const& filename) {
+  HostMDRangeTunerState& state = tuner_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  enable_tuning(state, exploration_launches, filename);
+}
+
+void HostMDRangeTuner::disable() {
+  HostMDRangeTunerState& state = tuner_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (!state.enabled.load(std::memory_order_relaxed)) return;
+
+  if (!state.filename.empty()) {
+    std::ofstream out(state.filename.c_str());
+    if (out) {
+      for (auto& kv : state.entries) {
+        TuneEntry& e = kv.second;
+        if (e.best < 0) settle(e);
+        out << kv.first << ' ' << e.rank;
+        for (int i = 0; i < e.rank; ++i) {
+          out << ' ' << e.tiles[e.best * e.rank + i];
+        }
+        out << '\n';
+      }
+    } else {
+      std::cerr << "Kokkos::Impl::HostMDRangeTuner WARNING: could not open '"
+                << state.filename << "' for writing" << std::endl;
+    }
+  }
+
+  state.enabled.store(false, std::memory_order_relaxed);
+  state.file_loaded = false;
+  state.entries.clear();
+}
+
+int HostMDRangeTuner::select(std::string const& key, int rank,
+                             bool inner_right, const long span[], long tile[],
+                             int concurrency) {
+  HostMDRangeTunerState& state = tuner_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (!state.enabled.load(std::memory_order_relaxed) || rank < 1 ||
+      max_rank < rank) {
+    return -1;
+  }
+
+  load_file(state);
+
+  auto iter = state.entries.find(key);
+  if (iter == state.entries.end()) {
+    iter = state.entries
+               .insert(std::make_pair(
+                   key, make_entry(rank, inner_right, span, tile, concurrency)))
+               .first;
+  }
+
+  TuneEntry& e = iter->second;
+
+  if (e.best < 0 && state.exploration <= e.launches) settle(e);
+
+  const int candidate =
+      e.best < 0 ? e.launches++ % e.candidates() : e.best;
+
+  for (int i = 0; i < rank; ++i) tile[i] = e.tiles[candidate * rank + i];
+
+  return e.best < 0 ? candidate : -1;
+}
+
+void HostMDRangeTuner::record(std::string const& key, int candidate,
+                              double seconds) {
+  HostMDRangeTunerState& state = tuner_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  auto iter = state.entries.find(key);
+  if (iter != state.entries.end() && 0 <= candidate &&
+      candidate < iter->second.candidates()) {
+    double& fastest = iter->second.seconds[candidate];
+    if (fastest < 0 || seconds < fastest) fastest = seconds;
+  }
+}
+
+bool HostMDRangeTuner::settled_tile(std::string const& key, int rank,
+                                    long tile[]) {
+  HostMDRangeTunerState& state = tuner_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  auto iter = state.entries.find(key);
+  if (iter == state.entries.end() || iter->second.best < 0 ||
+      iter->second.rank != rank) {
+    return false;
+  }
+  for (int i = 0; i < rank; ++i) {
+    tile[i] = iter->second.tiles[iter->second.best * rank + i];
+  }
+  return true;
+}
+
+void HostMDRangeTuner::cache_sizes(std::size_t& l1, std::size_t& l2) {
+  l1 = 32 * 1024;
+  l2 = 1024 * 1024;
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+  const long l1_query = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+  const long l2_query = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  if (0 < l1_query) l1 = l1_query;
+  if (0 < l2_query) l2 = l2_query;
+#endif
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
@@ -0,0 +1,177 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_HOSTMDRANGETUNER_HPP
+#define KOKKOS_IMPL_HOSTMDRANGETUNER_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Timer.hpp>
+
+#include <cstddef>
+#include <string>
+#include <typeinfo>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Tile shape autotuning of host MDRangePolicy parallel_for.
+ *
+ *  Tuning is disabled by default.  It is enabled at run time either by
+ *  setting the KOKKOS_MDRANGE_AUTOTUNE environment variable to the number
+ *  of exploration launches or by calling HostMDRangeTuner::enable().
+ *  Launches are keyed on the functor type, iteration direction and
+ *  extents.  The first exploration launches of a key cycle through
+ *  candidate tile shapes sized to the L1 and L2 data caches; every later
+ *  launch uses the candidate with the fastest observed time.
+ *  If KOKKOS_MDRANGE_TUNE_FILE names a file then settled tiles are read
+ *  from it at the first launch and written back by
+ *  HostMDRangeTuner::disable(), which Kokkos::finalize() calls.
+ *
+ *  Only policies whose tile dimensions were all left to the default are
+ *  tuned; an explicitly requested tile is always honored.
+ */
+class HostMDRangeTuner {
+ public:
+  enum { max_rank = 8 };
+
+  static bool is_enabled();
+
+  /**\brief  Enable tuning with the given number of exploration launches
+   *         per key.  A non-empty file name persists the settled tiles.
+   */
+  static void enable(int exploration_launches,
+                     std::string const& filename = std::string());
+
+  /**\brief  Write the tile file, if any, and disable tuning. */
+  static void disable();
+
+  /**\brief  Choose the tile of the next launch of 'key'.
+   *
+   *  On input 'tile' holds the default tile, on output the chosen tile.
+   *  Returns the candidate index to report to record(), or -1 if the key
+   *  has settled and the launch need not be timed.
+   */
+  static int select(std::string const& key, int rank, bool inner_right,
+                    const long span[], long tile[], int concurrency);
+
+  /**\brief  Report the time of a launch with the given candidate. */
+  static void record(std::string const& key, int candidate, double seconds);
+
+  /**\brief  Tile chosen for a key, false if the key has not settled. */
+  static bool settled_tile(std::string const& key, int rank, long tile[]);
+
+  /**\brief  Per-core data cache sizes in bytes. */
+  static void cache_sizes(std::size_t& l1, std::size_t& l2);
+};
+
+/** \brief  One tuned launch of a host MDRangePolicy.
+ *
+ *  Construction selects the tile and starts the clock, destruction
+ *  reports the elapsed time.  The launch must be synchronous.
+ */
+template <class MDRangePolicy>
+class HostMDRangeTunedLaunch {
+ private:
+  enum { rank = MDRangePolicy::rank };
+
+  std::string m_key;
+  MDRangePolicy m_policy;
+  int m_candidate;
+  Kokkos::Timer m_timer;
+
+ public:
+  template <class FunctorType>
+  static std::string key(const MDRangePolicy& policy) {
+    std::string k(typeid(FunctorType).name());
+    k += (int)MDRangePolicy::inner_direction == (int)MDRangePolicy::Right
+             ? ":R"
+             : ":L";
+    for (int i = 0; i < rank; ++i) {
+      k += ':';
+      k += std::to_string(policy.m_upper[i] - policy.m_lower[i]);
+    }
+    return k;
+  }
+
+  template <class FunctorType>
+  HostMDRangeTunedLaunch(const MDRangePolicy& policy, const FunctorType&,
+                         const int concurrency)
+      : m_key(key<FunctorType>(policy)), m_policy(policy), m_candidate(-1) {
+    long span[rank];
+    typename MDRangePolicy::tile_type tile;
+
+    for (int i = 0; i < rank; ++i) {
+      span[i] = policy.m_upper[i] - policy.m_lower[i];
+      tile[i] = policy.m_tile[i];
+    }
+
+    m_candidate = HostMDRangeTuner::select(
+        m_key, rank,
+        (int)MDRangePolicy::inner_direction == (int)MDRangePolicy::Right, span,
+        tile.data(), concurrency);
+
+    m_policy = MDRangePolicy(policy.space(), policy.m_lower, policy.m_upper,
+                             tile);
+    m_timer.reset();
+  }
+
+  ~HostMDRangeTunedLaunch() {
+    if (0 <= m_candidate) {
+      HostMDRangeTuner::record(m_key, m_candidate, m_timer.seconds());
+    }
+  }
+
+  const MDRangePolicy& policy() const { return m_policy; }
+
+  HostMDRangeTunedLaunch(const HostMDRangeTunedLaunch&) = delete;
+  HostMDRangeTunedLaunch& operator=(const HostMDRangeTunedLaunch&) = delete;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_IMPL_HOSTMDRANGETUNER_HPP */
@@ -202,6 +202,31 @@ void HostThreadTeamData::disband_team() {
 
 //----------------------------------------------------------------------------
 
+bool HostThreadTeamData::next_steal_rank() noexcept {
+  if (nullptr != m_pool_scratch) {
+    HostThreadTeamData *const *const pool =
+        (HostThreadTeamData **)(m_pool_scratch + m_pool_members);
+
+    while (m_steal_level <= max_steal_level) {
+      // The next team is offset by m_team_alloc if it fits in the pool.
+      m_steal_rank = m_steal_rank + m_team_alloc + m_team_size <= m_pool_size
+                         ? m_steal_rank + m_team_alloc
+                         : 0;
+
+      if (m_steal_rank == m_team_base) {
+        // Visited all teams at this level, move out one level
+        ++m_steal_level;
+      } else if (steal_level(*pool[m_steal_rank]) == m_steal_level) {
+        return true;
+      }
+    }
+  }
+
+  m_steal_rank = m_team_base;
+
+  return false;
+}
+
 int HostThreadTeamData::get_work_stealing() noexcept {
   pair_int_t w(-1, -1);
 
@@ -266,19 +291,11 @@ int HostThreadTeamData::get_work_stealing() noexcept {
           w.first  = -1;
           w.second = -1;
 
-          // We need to figure out whether the next team is active
-          // m_steal_rank + m_team_alloc could be the next base_rank to steal
-          // from but only if there are another m_team_size threads available so
-          // that that base rank has a full team.
-          m_steal_rank =
-              m_steal_rank + m_team_alloc + m_team_size <= m_pool_size
-                  ? m_steal_rank + m_team_alloc
-                  : 0;
+          // Move on to the next full team in order of locality.
+          // If tried all other members then don't repeat attempt to steal
+          attempt = next_steal_rank();
 
           steal_range = &(pool[m_steal_rank]->m_work_range);
-
-          // If tried all other members then don't repeat attempt to steal
-          attempt = m_steal_rank != m_pool_rank;
         }
       }
 
@@ -99,6 +99,7 @@ class HostThreadTeamData {
 
   pair_int_t m_work_range;
   int64_t m_work_end;
+  int64_t m_work_guided;  // next guided work index, used on pool member 0
   int64_t* m_scratch;       // per-thread buffer
   int64_t* m_pool_scratch;  // == pool[0]->m_scratch
   int64_t* m_team_scratch;  // == pool[ 0 + m_team_base ]->m_scratch
@@ -115,7 +116,10 @@ class HostThreadTeamData {
   int m_league_rank;
   int m_league_size;
   int m_work_chunk;
-  int m_steal_rank;  // work stealing rank
+  int m_steal_rank;   // work stealing rank
+  int m_steal_level;  // locality level of m_steal_rank, see steal_level()
+  int m_numa_coord;   // hardware coordinate of this thread, -1 if unknown
+  int m_core_coord;
   int mutable m_pool_rendezvous_step;
   int mutable m_team_rendezvous_step;
 
@@ -189,6 +193,7 @@ class HostThreadTeamData {
   constexpr HostThreadTeamData() noexcept
       : m_work_range(-1, -1),
         m_work_end(0),
+        m_work_guided(0),
         m_scratch(nullptr),
         m_pool_scratch(nullptr),
         m_team_scratch(nullptr),
@@ -206,6 +211,9 @@ class HostThreadTeamData {
         m_league_size(1),
         m_work_chunk(0),
         m_steal_rank(0),
+        m_steal_level(0),
+        m_numa_coord(-1),
+        m_core_coord(-1),
         m_pool_rendezvous_step(0),
         m_team_rendezvous_step(0) {}
 
@@ -241,6 +249,15 @@ class HostThreadTeamData {
 
   constexpr int pool_rank() const { return m_pool_rank; }
   constexpr int pool_size() const { return m_pool_size; }
+  constexpr int steal_rank() const { return m_steal_rank; }
+
+  // Set the (NUMA,core) coordinate of the thread owning this data,
+  // e.g., from Kokkos::hwloc::get_this_thread_coordinate().
+  // Used to order work stealing by locality.
+  void set_thread_coordinate(std::pair<unsigned, unsigned> const coord) {
+    m_numa_coord = static_cast<int>(coord.first);
+    m_core_coord = static_cast<int>(coord.second);
+  }
 
   HostThreadTeamData* pool_member(int r) const noexcept {
     return ((HostThreadTeamData**)(m_pool_scratch + m_pool_members))[r];
@@ -363,6 +380,26 @@ fflush(stdout);
 #endif
   }
 
+  //----------------------------------------
+  // Locality of another pool member relative to this member:
+  //   0 : same core, i.e., a hyperthread sibling
+  //   1 : same NUMA region
+  //   2 : remote NUMA region, or coordinates unknown
+  enum : int { max_steal_level = 2 };
+
+  int steal_level(HostThreadTeamData const& other) const noexcept {
+    return (m_numa_coord < 0 || other.m_numa_coord < 0 ||
+            m_numa_coord != other.m_numa_coord)
+               ? 2
+               : (m_core_coord != other.m_core_coord ? 1 : 0);
+  }
+
+  // Advance m_steal_rank to the base rank of the next team to steal from.
+  // All teams at steal level 0 are visited before those at level 1,
+  // and so on, each level in round robin order starting after this team.
+  // Return false, with m_steal_rank == m_team_base, when all have been visited.
+  bool next_steal_rank() noexcept;
+
   //----------------------------------------
   // Get a work index within the range.
   // First try to steal from beginning of own teams's partition.
@@ -390,12 +427,15 @@ fflush(stdout);
     m_work_range.first  = part * m_league_rank;
     m_work_range.second = m_work_range.first + part;
 
-    // Steal from next team, round robin
-    // The next team is offset by m_team_alloc if it fits in the pool.
+    // Guided scheduling claims from a counter on the root of the pool
+    if (0 == m_pool_rank) m_work_guided = 0;
 
-    m_steal_rank = m_team_base + m_team_alloc + m_team_size <= m_pool_size
-                       ? m_team_base + m_team_alloc
-                       : 0;
+    // Steal from the nearest team first, see next_steal_rank()
+
+    m_steal_level = m_numa_coord < 0 ? int(max_steal_level) : 0;
+    m_steal_rank  = m_team_base;
+
+    next_steal_rank();
   }
 
   std::pair<int64_t, int64_t> get_work_partition() noexcept {
@@ -420,6 +460,91 @@ fflush(stdout);
 
     return x;
   }
+
+  //----------------------------------------
+  // Guided self-scheduling of [ 0 .. length ) set by set_work_partition.
+  // Each call claims the next chunk of roughly remaining / ( 2 * league_size )
+  // indices but never fewer than min_chunk.
+  // Requires a pool rendezvous between set_work_partition and the first call.
+  // Returns (-1,-1) when no work remains.
+  std::pair<int64_t, int64_t> get_work_guided_chunk(
+      int64_t const min_chunk) noexcept {
+    int64_t volatile* const next =
+        m_pool_scratch ? &(pool_member(0)->m_work_guided) : &m_work_guided;
+
+    int64_t begin = *next;
+
+    while (begin < m_work_end) {
+      int64_t const remain = m_work_end - begin;
+      int64_t n            = remain / (2 * m_league_size);
+      if (n < min_chunk) n = min_chunk;
+      if (remain < n) n = remain;
+
+      int64_t const claimed =
+          Kokkos::atomic_compare_exchange(next, begin, begin + n);
+
+      if (claimed == begin) {
+        return std::pair<int64_t, int64_t>(begin, begin + n);
+      }
+
+      begin = claimed;
+    }
+
+    return std::pair<int64_t, int64_t>(-1, -1);
+  }
+};
+
+//----------------------------------------------------------------------------
+// Minimum chunk size of the Adaptive schedule for one kernel.
+// Starts from the policy's chunk size and is halved after launches with
+// significant load imbalance among the pool members, or doubled after
+// well balanced launches to reduce contention on the work counter.
+
+class HostAdaptiveChunk {
+ private:
+  int64_t m_chunk;  // 0 until the first launch
+
+ public:
+  // Imbalance is 1 - mean( busy ) / max( busy )
+  static constexpr double shrink_imbalance = 0.05;
+  static constexpr double grow_imbalance   = 0.01;
+
+  constexpr HostAdaptiveChunk() noexcept : m_chunk(0) {}
+
+  // Current minimum chunk size, 0 before the first launch
+  int64_t current() const noexcept { return m_chunk; }
+
+  int64_t chunk_size(int64_t const policy_chunk) noexcept {
+    int64_t c = Kokkos::atomic_fetch_add(&m_chunk, int64_t(0));
+    if (0 == c) {
+      c = policy_chunk < 1 ? 1 : policy_chunk;
+      Kokkos::atomic_compare_exchange(&m_chunk, int64_t(0), c);
+    }
+    return c;
+  }
+
+  // Given the work length, pool size and per-member busy time statistics
+  // of the launch that used chunk_size() == used_chunk.
+  void update(int64_t const used_chunk, int64_t const length,
+              int const pool_size, int64_t const busy_sum,
+              int64_t const busy_max) noexcept {
+    if (busy_max <= 0 || pool_size <= 1) return;
+
+    double const imbalance =
+        1.0 - double(busy_sum) / (double(pool_size) * double(busy_max));
+
+    // Never grow beyond an even share of the work per pool member
+    int64_t const max_chunk = std::max(int64_t(1), length / (4 * pool_size));
+
+    int64_t c = used_chunk;
+    if (shrink_imbalance < imbalance) {
+      c = std::max(int64_t(1), c / 2);
+    } else if (imbalance < grow_imbalance) {
+      c = std::min(max_chunk, 2 * c);
+    }
+
+    Kokkos::atomic_compare_exchange(&m_chunk, used_chunk, c);
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -936,6 +1061,99 @@ Impl::TeamThreadRangeBoundariesStruct<iType,Impl::HostThreadTeamMember<Space> >
   loop_boundaries.thread.team_reduce( reducer );
 }*/
 
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+/** \brief  Number of interleaved partial results of a host
+ *          ThreadVectorRange reduction.
+ *
+ *  As many values as fit in one vector register of the target ISA,
+ *  at most sixteen.  Values wider than half a register use one.
+ */
+template <typename ValueType>
+struct HostThreadVectorLanes {
+#if defined(__AVX512F__)
+  enum : int { register_bytes = 64 };
+#elif defined(__AVX__)
+  enum : int { register_bytes = 32 };
+#else
+  enum : int { register_bytes = 16 };
+#endif
+
+  enum : int {
+    value = 2 * sizeof(ValueType) <= register_bytes
+                ? (16 * sizeof(ValueType) < register_bytes
+                       ? 16
+                       : int(register_bytes / sizeof(ValueType)))
+                : 1
+  };
+};
+
+/** \brief  Join of the plain (non-reducer) ThreadVectorRange reduction. */
+template <typename ValueType>
+struct HostThreadVectorSum {
+  typedef ValueType value_type;
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& val) const { val = value_type(); }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dest, value_type const& src) const { dest += src; }
+};
+
+/** \brief  Host ThreadVectorRange reduction of closure(i, value) over
+ *          [begin, end) into result.
+ *
+ *  Accumulating every iteration into 'result' is one loop-carried
+ *  dependency, which defeats vectorization.  Instead lane k of
+ *  HostThreadVectorLanes partial results accumulates iterations
+ *  begin + k, begin + k + N, ...; the lanes are independent and the
+ *  inner loop over them has a compile-time trip count, so it unrolls
+ *  and vectorizes.  The lanes are joined into result with the reducer.
+ *  Short ranges are not worth the extra init and join calls.
+ */
+template <typename iType, class Closure, class Reducer>
+KOKKOS_INLINE_FUNCTION void host_thread_vector_reduce(
+    iType const begin, iType const end, Closure const& closure,
+    Reducer const& reducer, typename Reducer::value_type& result) {
+  typedef typename Reducer::value_type value_type;
+
+  enum : int { N = HostThreadVectorLanes<value_type>::value };
+
+  reducer.init(result);
+
+  if (N == 1 || end <= begin || iType(end - begin) < iType(2 * N)) {
+    for (iType i = begin; i < end; ++i) {
+      closure(i, result);
+    }
+    return;
+  }
+
+  value_type lane[N];
+
+  for (int k = 0; k < N; ++k) reducer.init(lane[k]);
+
+  iType i = begin;
+
+  for (iType const last = end - iType(N); i <= last; i += iType(N)) {
+#ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
+#pragma unroll
+#endif
+    for (int k = 0; k < N; ++k) {
+      closure(iType(i + k), lane[k]);
+    }
+  }
+
+  for (int k = 0; k < N; ++k) {
+    if (iType(i + k) < end) closure(iType(i + k), lane[k]);
+  }
+
+  for (int k = 0; k < N; ++k) reducer.join(result, lane[k]);
+}
+
+}  // namespace Impl
+
 //----------------------------------------------------------------------------
 /** \brief  Inter-thread vector parallel_reduce.
  *
@@ -952,11 +1170,9 @@ KOKKOS_INLINE_FUNCTION typename std::enable_if<
 parallel_reduce(const Impl::ThreadVectorRangeBoundariesStruct<iType, Member>&
                     loop_boundaries,
                 const Lambda& lambda, ValueType& result) {
-  result = ValueType();
-  for (iType i = loop_boundaries.start; i < loop_boundaries.end;
-       i += loop_boundaries.increment) {
-    lambda(i, result);
-  }
+  Impl::host_thread_vector_reduce(
+      loop_boundaries.start, loop_boundaries.end, lambda,
+      Impl::HostThreadVectorSum<ValueType>(), result);
 }
 
 template <typename iType, class Lambda, typename ReducerType, typename Member>
@@ -966,11 +1182,8 @@ KOKKOS_INLINE_FUNCTION typename std::enable_if<
 parallel_reduce(const Impl::ThreadVectorRangeBoundariesStruct<iType, Member>&
                     loop_boundaries,
                 const Lambda& lambda, const ReducerType& reducer) {
-  reducer.init(reducer.reference());
-  for (iType i = loop_boundaries.start; i < loop_boundaries.end;
-       i += loop_boundaries.increment) {
-    lambda(i, reducer.reference());
-  }
+  Impl::host_thread_vector_reduce(loop_boundaries.start, loop_boundaries.end,
+                                  lambda, reducer, reducer.reference());
 }
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,491 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_AVX2_HPP
+#define KOKKOS_SIMD_AVX2_HPP
+
+#if defined(KOKKOS_IMPL_SIMD_AVX2)
+
+#include <immintrin.h>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Four doubles in a 256 bit AVX register.
+ *
+ *  Masks are full-width lane masks as produced by _mm256_cmp_pd,
+ *  which is the form consumed by blendv, maskload and masked gather.
+ */
+template <>
+struct simd_impl<double, Kokkos::Experimental::simd_abi::avx2> {
+  typedef __m256d native_type;
+  typedef __m256d mask_type;
+
+  enum : int { size = 4 };
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type broadcast(double const v) { return _mm256_set1_pd(v); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load(double const* const p) { return _mm256_loadu_pd(p); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load_aligned(double const* const p) {
+    return _mm256_load_pd(p);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store(double* const p, native_type const a) {
+    _mm256_storeu_pd(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store_aligned(double* const p, native_type const a) {
+    _mm256_store_pd(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_load(mask_type const m, double const* const p,
+                               native_type const a) {
+    return _mm256_blendv_pd(a, _mm256_maskload_pd(p, _mm256_castpd_si256(m)),
+                            m);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_store(mask_type const m, double* const p,
+                         native_type const a) {
+    _mm256_maskstore_pd(p, _mm256_castpd_si256(m), a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double get(native_type const a, int const i) {
+    alignas(32) double tmp[size];
+    _mm256_store_pd(tmp, a);
+    return tmp[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type add(native_type const a, native_type const b) {
+    return _mm256_add_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sub(native_type const a, native_type const b) {
+    return _mm256_sub_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mul(native_type const a, native_type const b) {
+    return _mm256_mul_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type div(native_type const a, native_type const b) {
+    return _mm256_div_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type neg(native_type const a) {
+    return _mm256_xor_pd(a, _mm256_set1_pd(-0.0));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type min(native_type const a, native_type const b) {
+    return _mm256_min_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type max(native_type const a, native_type const b) {
+    return _mm256_max_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sqrt(native_type const a) { return _mm256_sqrt_pd(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type abs(native_type const a) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type fma(native_type const a, native_type const b,
+                         native_type const c) {
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_eq(native_type const a, native_type const b) {
+    return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_ne(native_type const a, native_type const b) {
+    return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_lt(native_type const a, native_type const b) {
+    return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_le(native_type const a, native_type const b) {
+    return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type blend(mask_type const m, native_type const a,
+                           native_type const b) {
+    return _mm256_blendv_pd(b, a, m);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_broadcast(bool const v) {
+    return _mm256_castsi256_pd(_mm256_set1_epi64x(v ? -1 : 0));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_and(mask_type const a, mask_type const b) {
+    return _mm256_and_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_or(mask_type const a, mask_type const b) {
+    return _mm256_or_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_not(mask_type const a) {
+    return _mm256_xor_pd(a, mask_broadcast(true));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static unsigned mask_bits(mask_type const a) {
+    return unsigned(_mm256_movemask_pd(a));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_add(native_type const a) {
+    __m128d const s = _mm_add_pd(_mm256_castpd256_pd128(a),
+                                 _mm256_extractf128_pd(a, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_min(native_type const a) {
+    __m128d const s = _mm_min_pd(_mm256_castpd256_pd128(a),
+                                 _mm256_extractf128_pd(a, 1));
+    return _mm_cvtsd_f64(_mm_min_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_max(native_type const a) {
+    __m128d const s = _mm_max_pd(_mm256_castpd256_pd128(a),
+                                 _mm256_extractf128_pd(a, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type gather(double const* const p,
+                            std::int32_t const* const i) {
+    return _mm256_i32gather_pd(p, _mm_loadu_si128((__m128i const*)i), 8);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_gather(mask_type const m, double const* const p,
+                                 std::int32_t const* const i,
+                                 native_type const a) {
+    return _mm256_mask_i32gather_pd(a, p, _mm_loadu_si128((__m128i const*)i),
+                                    m, 8);
+  }
+
+  // AVX2 has no scatter instruction.
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void scatter(double* const p, std::int32_t const* const i,
+                      native_type const a) {
+    alignas(32) double tmp[size];
+    _mm256_store_pd(tmp, a);
+    for (int k = 0; k < size; ++k) p[i[k]] = tmp[k];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_scatter(mask_type const m, double* const p,
+                           std::int32_t const* const i, native_type const a) {
+    alignas(32) double tmp[size];
+    _mm256_store_pd(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) p[i[k]] = tmp[k];
+    }
+  }
+};
+
+/** \brief  Eight floats in a 256 bit AVX register. */
+template <>
+struct simd_impl<float, Kokkos::Experimental::simd_abi::avx2> {
+  typedef __m256 native_type;
+  typedef __m256 mask_type;
+
+  enum : int { size = 8 };
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type broadcast(float const v) { return _mm256_set1_ps(v); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load(float const* const p) { return _mm256_loadu_ps(p); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load_aligned(float const* const p) {
+    return _mm256_load_ps(p);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store(float* const p, native_type const a) {
+    _mm256_storeu_ps(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store_aligned(float* const p, native_type const a) {
+    _mm256_store_ps(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_load(mask_type const m, float const* const p,
+                               native_type const a) {
+    return _mm256_blendv_ps(a, _mm256_maskload_ps(p, _mm256_castps_si256(m)),
+                            m);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_store(mask_type const m, float* const p,
+                         native_type const a) {
+    _mm256_maskstore_ps(p, _mm256_castps_si256(m), a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float get(native_type const a, int const i) {
+    alignas(32) float tmp[size];
+    _mm256_store_ps(tmp, a);
+    return tmp[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type add(native_type const a, native_type const b) {
+    return _mm256_add_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sub(native_type const a, native_type const b) {
+    return _mm256_sub_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mul(native_type const a, native_type const b) {
+    return _mm256_mul_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type div(native_type const a, native_type const b) {
+    return _mm256_div_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type neg(native_type const a) {
+    return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type min(native_type const a, native_type const b) {
+    return _mm256_min_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type max(native_type const a, native_type const b) {
+    return _mm256_max_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sqrt(native_type const a) { return _mm256_sqrt_ps(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type abs(native_type const a) {
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type fma(native_type const a, native_type const b,
+                         native_type const c) {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_eq(native_type const a, native_type const b) {
+    return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_ne(native_type const a, native_type const b) {
+    return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_lt(native_type const a, native_type const b) {
+    return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_le(native_type const a, native_type const b) {
+    return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type blend(mask_type const m, native_type const a,
+                           native_type const b) {
+    return _mm256_blendv_ps(b, a, m);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_broadcast(bool const v) {
+    return _mm256_castsi256_ps(_mm256_set1_epi32(v ? -1 : 0));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_and(mask_type const a, mask_type const b) {
+    return _mm256_and_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_or(mask_type const a, mask_type const b) {
+    return _mm256_or_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_not(mask_type const a) {
+    return _mm256_xor_ps(a, mask_broadcast(true));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static unsigned mask_bits(mask_type const a) {
+    return unsigned(_mm256_movemask_ps(a));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_add(native_type const a) {
+    __m128 s =
+        _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_min(native_type const a) {
+    __m128 s =
+        _mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    s = _mm_min_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_min_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_max(native_type const a) {
+    __m128 s =
+        _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    s = _mm_max_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_max_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type gather(float const* const p,
+                            std::int32_t const* const i) {
+    return _mm256_i32gather_ps(p, _mm256_loadu_si256((__m256i const*)i), 4);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_gather(mask_type const m, float const* const p,
+                                 std::int32_t const* const i,
+                                 native_type const a) {
+    return _mm256_mask_i32gather_ps(
+        a, p, _mm256_loadu_si256((__m256i const*)i), m, 4);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void scatter(float* const p, std::int32_t const* const i,
+                      native_type const a) {
+    alignas(32) float tmp[size];
+    _mm256_store_ps(tmp, a);
+    for (int k = 0; k < size; ++k) p[i[k]] = tmp[k];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_scatter(mask_type const m, float* const p,
+                           std::int32_t const* const i, native_type const a) {
+    alignas(32) float tmp[size];
+    _mm256_store_ps(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) p[i[k]] = tmp[k];
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #if defined(KOKKOS_IMPL_SIMD_AVX2) */
+#endif /* #ifndef KOKKOS_SIMD_AVX2_HPP */
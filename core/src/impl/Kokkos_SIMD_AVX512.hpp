@@ -0,0 +1,513 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_AVX512_HPP
+#define KOKKOS_SIMD_AVX512_HPP
+
+#if defined(KOKKOS_IMPL_SIMD_AVX512)
+
+#include <immintrin.h>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Eight doubles in a 512 bit AVX-512 register.
+ *
+ *  Masks live in the opmask registers, so masked load, store, gather
+ *  and scatter are single instructions.  Only AVX-512F is required.
+ */
+template <>
+struct simd_impl<double, Kokkos::Experimental::simd_abi::avx512> {
+  typedef __m512d native_type;
+  typedef __mmask8 mask_type;
+
+  enum : int { size = 8 };
+
+  // The unmasked forms of min, max, sqrt, gather and of the 256 bit
+  // extracts pass an undefined register to the masked builtins, which
+  // GCC reports with -Wmaybe-uninitialized.  Use the masked forms with
+  // every lane selected and an explicit pass through operand instead.
+  static constexpr mask_type all = 0xff;
+
+  KOKKOS_IMPL_FORCEINLINE
+  static __m256d lower_half(native_type const a) {
+    return _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xf, a, 0);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static __m256d upper_half(native_type const a) {
+    return _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xf, a, 1);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type broadcast(double const v) { return _mm512_set1_pd(v); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load(double const* const p) { return _mm512_loadu_pd(p); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load_aligned(double const* const p) {
+    return _mm512_load_pd(p);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store(double* const p, native_type const a) {
+    _mm512_storeu_pd(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store_aligned(double* const p, native_type const a) {
+    _mm512_store_pd(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_load(mask_type const m, double const* const p,
+                               native_type const a) {
+    return _mm512_mask_loadu_pd(a, m, p);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_store(mask_type const m, double* const p,
+                         native_type const a) {
+    _mm512_mask_storeu_pd(p, m, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double get(native_type const a, int const i) {
+    alignas(64) double tmp[size];
+    _mm512_store_pd(tmp, a);
+    return tmp[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type add(native_type const a, native_type const b) {
+    return _mm512_add_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sub(native_type const a, native_type const b) {
+    return _mm512_sub_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mul(native_type const a, native_type const b) {
+    return _mm512_mul_pd(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type div(native_type const a, native_type const b) {
+    return _mm512_div_pd(a, b);
+  }
+
+  // Sign bit manipulation uses the integer logic ops with integer
+  // constants, the floating point ones are AVX-512DQ.
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type neg(native_type const a) {
+    return _mm512_castsi512_pd(
+        _mm512_xor_si512(_mm512_castpd_si512(a),
+                         _mm512_set1_epi64(static_cast<long long>(
+                             0x8000000000000000ULL))));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type min(native_type const a, native_type const b) {
+    return _mm512_mask_min_pd(a, all, a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type max(native_type const a, native_type const b) {
+    return _mm512_mask_max_pd(a, all, a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sqrt(native_type const a) {
+    return _mm512_mask_sqrt_pd(a, all, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type abs(native_type const a) {
+    return _mm512_castsi512_pd(
+        _mm512_and_si512(_mm512_castpd_si512(a),
+                         _mm512_set1_epi64(0x7fffffffffffffffLL)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type fma(native_type const a, native_type const b,
+                         native_type const c) {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_eq(native_type const a, native_type const b) {
+    return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_ne(native_type const a, native_type const b) {
+    return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_lt(native_type const a, native_type const b) {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_le(native_type const a, native_type const b) {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type blend(mask_type const m, native_type const a,
+                           native_type const b) {
+    return _mm512_mask_blend_pd(m, b, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_broadcast(bool const v) {
+    return mask_type(v ? 0xff : 0);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_and(mask_type const a, mask_type const b) {
+    return mask_type(a & b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_or(mask_type const a, mask_type const b) {
+    return mask_type(a | b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_not(mask_type const a) { return mask_type(~a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static unsigned mask_bits(mask_type const a) { return unsigned(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_add(native_type const a) {
+    __m256d const h = _mm256_add_pd(lower_half(a), upper_half(a));
+    __m128d const s = _mm_add_pd(_mm256_castpd256_pd128(h),
+                                 _mm256_extractf128_pd(h, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_min(native_type const a) {
+    __m256d const h = _mm256_min_pd(lower_half(a), upper_half(a));
+    __m128d const s = _mm_min_pd(_mm256_castpd256_pd128(h),
+                                 _mm256_extractf128_pd(h, 1));
+    return _mm_cvtsd_f64(_mm_min_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_max(native_type const a) {
+    __m256d const h = _mm256_max_pd(lower_half(a), upper_half(a));
+    __m128d const s = _mm_max_pd(_mm256_castpd256_pd128(h),
+                                 _mm256_extractf128_pd(h, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type gather(double const* const p,
+                            std::int32_t const* const i) {
+    return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), all,
+                                    _mm256_loadu_si256((__m256i const*)i), p,
+                                    8);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_gather(mask_type const m, double const* const p,
+                                 std::int32_t const* const i,
+                                 native_type const a) {
+    return _mm512_mask_i32gather_pd(
+        a, m, _mm256_loadu_si256((__m256i const*)i), p, 8);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void scatter(double* const p, std::int32_t const* const i,
+                      native_type const a) {
+    _mm512_i32scatter_pd(p, _mm256_loadu_si256((__m256i const*)i), a, 8);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_scatter(mask_type const m, double* const p,
+                           std::int32_t const* const i, native_type const a) {
+    _mm512_mask_i32scatter_pd(p, m, _mm256_loadu_si256((__m256i const*)i), a,
+                              8);
+  }
+};
+
+/** \brief  Sixteen floats in a 512 bit AVX-512 register. */
+template <>
+struct simd_impl<float, Kokkos::Experimental::simd_abi::avx512> {
+  typedef __m512 native_type;
+  typedef __mmask16 mask_type;
+
+  enum : int { size = 16 };
+
+  // Masked forms with an explicit pass through, see the double version
+  static constexpr mask_type all = 0xffff;
+
+  KOKKOS_IMPL_FORCEINLINE
+  static __m256 lower_half(native_type const a) {
+    return _mm256_castpd_ps(_mm512_mask_extractf64x4_pd(
+        _mm256_setzero_pd(), 0xf, _mm512_castps_pd(a), 0));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static __m256 upper_half(native_type const a) {
+    return _mm256_castpd_ps(_mm512_mask_extractf64x4_pd(
+        _mm256_setzero_pd(), 0xf, _mm512_castps_pd(a), 1));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type broadcast(float const v) { return _mm512_set1_ps(v); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load(float const* const p) { return _mm512_loadu_ps(p); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load_aligned(float const* const p) {
+    return _mm512_load_ps(p);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store(float* const p, native_type const a) {
+    _mm512_storeu_ps(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store_aligned(float* const p, native_type const a) {
+    _mm512_store_ps(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_load(mask_type const m, float const* const p,
+                               native_type const a) {
+    return _mm512_mask_loadu_ps(a, m, p);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_store(mask_type const m, float* const p,
+                         native_type const a) {
+    _mm512_mask_storeu_ps(p, m, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float get(native_type const a, int const i) {
+    alignas(64) float tmp[size];
+    _mm512_store_ps(tmp, a);
+    return tmp[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type add(native_type const a, native_type const b) {
+    return _mm512_add_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sub(native_type const a, native_type const b) {
+    return _mm512_sub_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mul(native_type const a, native_type const b) {
+    return _mm512_mul_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type div(native_type const a, native_type const b) {
+    return _mm512_div_ps(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type neg(native_type const a) {
+    return _mm512_castsi512_ps(
+        _mm512_xor_si512(_mm512_castps_si512(a),
+                         _mm512_set1_epi32(static_cast<int>(0x80000000u))));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type min(native_type const a, native_type const b) {
+    return _mm512_mask_min_ps(a, all, a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type max(native_type const a, native_type const b) {
+    return _mm512_mask_max_ps(a, all, a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sqrt(native_type const a) {
+    return _mm512_mask_sqrt_ps(a, all, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type abs(native_type const a) {
+    return _mm512_castsi512_ps(
+        _mm512_and_si512(_mm512_castps_si512(a),
+                         _mm512_set1_epi32(0x7fffffff)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type fma(native_type const a, native_type const b,
+                         native_type const c) {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_eq(native_type const a, native_type const b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_ne(native_type const a, native_type const b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_lt(native_type const a, native_type const b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_le(native_type const a, native_type const b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type blend(mask_type const m, native_type const a,
+                           native_type const b) {
+    return _mm512_mask_blend_ps(m, b, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_broadcast(bool const v) {
+    return mask_type(v ? 0xffff : 0);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_and(mask_type const a, mask_type const b) {
+    return mask_type(a & b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_or(mask_type const a, mask_type const b) {
+    return mask_type(a | b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_not(mask_type const a) { return mask_type(~a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static unsigned mask_bits(mask_type const a) { return unsigned(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_add(native_type const a) {
+    __m256 const h = _mm256_add_ps(lower_half(a), upper_half(a));
+    __m128 s =
+        _mm_add_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_min(native_type const a) {
+    __m256 const h = _mm256_min_ps(lower_half(a), upper_half(a));
+    __m128 s =
+        _mm_min_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1));
+    s = _mm_min_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_min_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_max(native_type const a) {
+    __m256 const h = _mm256_max_ps(lower_half(a), upper_half(a));
+    __m128 s =
+        _mm_max_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1));
+    s = _mm_max_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_max_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type gather(float const* const p,
+                            std::int32_t const* const i) {
+    return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), all,
+                                    _mm512_loadu_si512(i), p, 4);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_gather(mask_type const m, float const* const p,
+                                 std::int32_t const* const i,
+                                 native_type const a) {
+    return _mm512_mask_i32gather_ps(a, m, _mm512_loadu_si512(i), p, 4);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void scatter(float* const p, std::int32_t const* const i,
+                      native_type const a) {
+    _mm512_i32scatter_ps(p, _mm512_loadu_si512(i), a, 4);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_scatter(mask_type const m, float* const p,
+                           std::int32_t const* const i, native_type const a) {
+    _mm512_mask_i32scatter_ps(p, m, _mm512_loadu_si512(i), a, 4);
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #if defined(KOKKOS_IMPL_SIMD_AVX512) */
+#endif /* #ifndef KOKKOS_SIMD_AVX512_HPP */
@@ -0,0 +1,472 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_NEON_HPP
+#define KOKKOS_SIMD_NEON_HPP
+
+#if defined(KOKKOS_IMPL_SIMD_NEON)
+
+#include <arm_neon.h>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Two doubles in a 128 bit AArch64 NEON register.
+ *
+ *  NEON has neither masked memory operations nor gather / scatter,
+ *  those are lane loops over the mask bits.
+ */
+template <>
+struct simd_impl<double, Kokkos::Experimental::simd_abi::neon> {
+  typedef float64x2_t native_type;
+  typedef uint64x2_t mask_type;
+
+  enum : int { size = 2 };
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type broadcast(double const v) { return vdupq_n_f64(v); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load(double const* const p) { return vld1q_f64(p); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load_aligned(double const* const p) {
+    return vld1q_f64(p);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store(double* const p, native_type const a) { vst1q_f64(p, a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store_aligned(double* const p, native_type const a) {
+    vst1q_f64(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_load(mask_type const m, double const* const p,
+                               native_type const a) {
+    alignas(16) double tmp[size];
+    vst1q_f64(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) tmp[k] = p[k];
+    }
+    return vld1q_f64(tmp);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_store(mask_type const m, double* const p,
+                         native_type const a) {
+    alignas(16) double tmp[size];
+    vst1q_f64(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) p[k] = tmp[k];
+    }
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double get(native_type const a, int const i) {
+    alignas(16) double tmp[size];
+    vst1q_f64(tmp, a);
+    return tmp[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type add(native_type const a, native_type const b) {
+    return vaddq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sub(native_type const a, native_type const b) {
+    return vsubq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mul(native_type const a, native_type const b) {
+    return vmulq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type div(native_type const a, native_type const b) {
+    return vdivq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type neg(native_type const a) { return vnegq_f64(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type min(native_type const a, native_type const b) {
+    return vminq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type max(native_type const a, native_type const b) {
+    return vmaxq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sqrt(native_type const a) { return vsqrtq_f64(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type abs(native_type const a) { return vabsq_f64(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type fma(native_type const a, native_type const b,
+                         native_type const c) {
+    return vfmaq_f64(c, a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_eq(native_type const a, native_type const b) {
+    return vceqq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_ne(native_type const a, native_type const b) {
+    return mask_not(vceqq_f64(a, b));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_lt(native_type const a, native_type const b) {
+    return vcltq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_le(native_type const a, native_type const b) {
+    return vcleq_f64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type blend(mask_type const m, native_type const a,
+                           native_type const b) {
+    return vbslq_f64(m, a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_broadcast(bool const v) {
+    return vdupq_n_u64(v ? ~std::uint64_t(0) : std::uint64_t(0));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_and(mask_type const a, mask_type const b) {
+    return vandq_u64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_or(mask_type const a, mask_type const b) {
+    return vorrq_u64(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_not(mask_type const a) {
+    return vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(a)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static unsigned mask_bits(mask_type const a) {
+    return unsigned(vgetq_lane_u64(a, 0) & 1u) |
+           unsigned(vgetq_lane_u64(a, 1) & 1u) << 1;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_add(native_type const a) { return vaddvq_f64(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_min(native_type const a) { return vminvq_f64(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static double reduce_max(native_type const a) { return vmaxvq_f64(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type gather(double const* const p,
+                            std::int32_t const* const i) {
+    alignas(16) double tmp[size] = {p[i[0]], p[i[1]]};
+    return vld1q_f64(tmp);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_gather(mask_type const m, double const* const p,
+                                 std::int32_t const* const i,
+                                 native_type const a) {
+    alignas(16) double tmp[size];
+    vst1q_f64(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) tmp[k] = p[i[k]];
+    }
+    return vld1q_f64(tmp);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void scatter(double* const p, std::int32_t const* const i,
+                      native_type const a) {
+    p[i[0]] = vgetq_lane_f64(a, 0);
+    p[i[1]] = vgetq_lane_f64(a, 1);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_scatter(mask_type const m, double* const p,
+                           std::int32_t const* const i, native_type const a) {
+    unsigned const bits = mask_bits(m);
+    if (bits & 1u) p[i[0]] = vgetq_lane_f64(a, 0);
+    if (bits & 2u) p[i[1]] = vgetq_lane_f64(a, 1);
+  }
+};
+
+/** \brief  Four floats in a 128 bit AArch64 NEON register. */
+template <>
+struct simd_impl<float, Kokkos::Experimental::simd_abi::neon> {
+  typedef float32x4_t native_type;
+  typedef uint32x4_t mask_type;
+
+  enum : int { size = 4 };
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type broadcast(float const v) { return vdupq_n_f32(v); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load(float const* const p) { return vld1q_f32(p); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type load_aligned(float const* const p) {
+    return vld1q_f32(p);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store(float* const p, native_type const a) { vst1q_f32(p, a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void store_aligned(float* const p, native_type const a) {
+    vst1q_f32(p, a);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_load(mask_type const m, float const* const p,
+                               native_type const a) {
+    alignas(16) float tmp[size];
+    vst1q_f32(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) tmp[k] = p[k];
+    }
+    return vld1q_f32(tmp);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_store(mask_type const m, float* const p,
+                         native_type const a) {
+    alignas(16) float tmp[size];
+    vst1q_f32(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) p[k] = tmp[k];
+    }
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float get(native_type const a, int const i) {
+    alignas(16) float tmp[size];
+    vst1q_f32(tmp, a);
+    return tmp[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type add(native_type const a, native_type const b) {
+    return vaddq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sub(native_type const a, native_type const b) {
+    return vsubq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mul(native_type const a, native_type const b) {
+    return vmulq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type div(native_type const a, native_type const b) {
+    return vdivq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type neg(native_type const a) { return vnegq_f32(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type min(native_type const a, native_type const b) {
+    return vminq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type max(native_type const a, native_type const b) {
+    return vmaxq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type sqrt(native_type const a) { return vsqrtq_f32(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type abs(native_type const a) { return vabsq_f32(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type fma(native_type const a, native_type const b,
+                         native_type const c) {
+    return vfmaq_f32(c, a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_eq(native_type const a, native_type const b) {
+    return vceqq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_ne(native_type const a, native_type const b) {
+    return vmvnq_u32(vceqq_f32(a, b));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_lt(native_type const a, native_type const b) {
+    return vcltq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type cmp_le(native_type const a, native_type const b) {
+    return vcleq_f32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type blend(mask_type const m, native_type const a,
+                           native_type const b) {
+    return vbslq_f32(m, a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_broadcast(bool const v) {
+    return vdupq_n_u32(v ? ~std::uint32_t(0) : std::uint32_t(0));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_and(mask_type const a, mask_type const b) {
+    return vandq_u32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_or(mask_type const a, mask_type const b) {
+    return vorrq_u32(a, b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static mask_type mask_not(mask_type const a) { return vmvnq_u32(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static unsigned mask_bits(mask_type const a) {
+    return unsigned(vgetq_lane_u32(a, 0) & 1u) |
+           unsigned(vgetq_lane_u32(a, 1) & 1u) << 1 |
+           unsigned(vgetq_lane_u32(a, 2) & 1u) << 2 |
+           unsigned(vgetq_lane_u32(a, 3) & 1u) << 3;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_add(native_type const a) { return vaddvq_f32(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_min(native_type const a) { return vminvq_f32(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static float reduce_max(native_type const a) { return vmaxvq_f32(a); }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type gather(float const* const p,
+                            std::int32_t const* const i) {
+    alignas(16) float tmp[size] = {p[i[0]], p[i[1]], p[i[2]], p[i[3]]};
+    return vld1q_f32(tmp);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static native_type mask_gather(mask_type const m, float const* const p,
+                                 std::int32_t const* const i,
+                                 native_type const a) {
+    alignas(16) float tmp[size];
+    vst1q_f32(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) tmp[k] = p[i[k]];
+    }
+    return vld1q_f32(tmp);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void scatter(float* const p, std::int32_t const* const i,
+                      native_type const a) {
+    alignas(16) float tmp[size];
+    vst1q_f32(tmp, a);
+    for (int k = 0; k < size; ++k) p[i[k]] = tmp[k];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE
+  static void mask_scatter(mask_type const m, float* const p,
+                           std::int32_t const* const i, native_type const a) {
+    alignas(16) float tmp[size];
+    vst1q_f32(tmp, a);
+    unsigned const bits = mask_bits(m);
+    for (int k = 0; k < size; ++k) {
+      if (bits & (1u << k)) p[i[k]] = tmp[k];
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #if defined(KOKKOS_IMPL_SIMD_NEON) */
+#endif /* #ifndef KOKKOS_SIMD_NEON_HPP */
@@ -0,0 +1,234 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_SCALAR_HPP
+#define KOKKOS_SIMD_SCALAR_HPP
+
+#include <cmath>
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  One lane of any arithmetic type.
+ *
+ *  Always available, including in device code, and therefore the
+ *  native ABI of every execution space without a vector ISA.
+ */
+template <class T>
+struct simd_impl<T, Kokkos::Experimental::simd_abi::scalar> {
+  typedef T native_type;
+  typedef bool mask_type;
+
+  enum : int { size = 1 };
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type broadcast(T const v) { return v; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type load(T const* const p) { return *p; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type load_aligned(T const* const p) { return *p; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void store(T* const p, native_type const a) { *p = a; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void store_aligned(T* const p, native_type const a) { *p = a; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type mask_load(mask_type const m, T const* const p,
+                               native_type const a) {
+    return m ? *p : a;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void mask_store(mask_type const m, T* const p, native_type const a) {
+    if (m) *p = a;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static T get(native_type const a, int) { return a; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type add(native_type const a, native_type const b) {
+    return a + b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type sub(native_type const a, native_type const b) {
+    return a - b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type mul(native_type const a, native_type const b) {
+    return a * b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type div(native_type const a, native_type const b) {
+    return a / b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type neg(native_type const a) { return -a; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type min(native_type const a, native_type const b) {
+    return b < a ? b : a;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type max(native_type const a, native_type const b) {
+    return a < b ? b : a;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type sqrt(native_type const a) {
+    using std::sqrt;
+    return sqrt(a);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type abs(native_type const a) {
+    using std::abs;
+    return abs(a);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type fma(native_type const a, native_type const b,
+                         native_type const c) {
+    return a * b + c;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mask_type cmp_eq(native_type const a, native_type const b) {
+    return a == b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mask_type cmp_ne(native_type const a, native_type const b) {
+    return a != b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mask_type cmp_lt(native_type const a, native_type const b) {
+    return a < b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mask_type cmp_le(native_type const a, native_type const b) {
+    return a <= b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type blend(mask_type const m, native_type const a,
+                           native_type const b) {
+    return m ? a : b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mask_type mask_broadcast(bool const v) { return v; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mask_type mask_and(mask_type const a, mask_type const b) {
+    return a && b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mask_type mask_or(mask_type const a, mask_type const b) {
+    return a || b;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mask_type mask_not(mask_type const a) { return !a; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned mask_bits(mask_type const a) { return a ? 1u : 0u; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static T reduce_add(native_type const a) { return a; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static T reduce_min(native_type const a) { return a; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static T reduce_max(native_type const a) { return a; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type gather(T const* const p, std::int32_t const* const i) {
+    return p[i[0]];
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static native_type mask_gather(mask_type const m, T const* const p,
+                                 std::int32_t const* const i,
+                                 native_type const a) {
+    return m ? p[i[0]] : a;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scatter(T* const p, std::int32_t const* const i,
+                      native_type const a) {
+    p[i[0]] = a;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void mask_scatter(mask_type const m, T* const p,
+                           std::int32_t const* const i, native_type const a) {
+    if (m) p[i[0]] = a;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #ifndef KOKKOS_SIMD_SCALAR_HPP */
@@ -53,6 +53,7 @@
 #include <impl/Kokkos_TaskQueue.hpp>
 #include <Kokkos_Serial.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_TaskTracer.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -90,6 +91,11 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::Serial, QueueType> > {
 
     member_type member(scheduler, self);
 
+    TaskTraceWorker* const trace =
+        TaskTracer::begin_execute(1) ? TaskTracer::worker(0) : nullptr;
+
+    if (trace) trace->start();
+
     auto current_task = OptionalRef<task_base_type>(nullptr);
 
     while (!queue.is_done()) {
@@ -99,14 +105,24 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::Serial, QueueType> > {
       // pop a task off
       current_task = queue.pop_ready_task(team_scheduler.team_scheduler_info());
 
+      if (trace) trace->count_pop();
+
       // run the task
       if (current_task) {
+        if (trace) {
+          trace->begin_execute();
+          trace->sample_depth(queue.ready_count());
+        }
         current_task->as_runnable_task().run(member);
+        if (trace) trace->end_execute();
         // Respawns are handled in the complete function
         queue.complete((*std::move(current_task)).as_runnable_task(),
                        team_scheduler.team_scheduler_info());
+        if (trace) trace->end_complete();
       }
     }
+
+    if (trace) trace->stop();
   }
 
   static constexpr uint32_t get_max_team_count(
@@ -194,6 +210,11 @@ class TaskQueueSpecializationConstrained<
 
     member_type exec(scheduler, *data);
 
+    TaskTraceWorker* const trace =
+        TaskTracer::begin_execute(1) ? TaskTracer::worker(0) : nullptr;
+
+    if (trace) trace->start();
+
     // Loop until all queues are empty
     while (0 < queue->m_ready_count) {
       task_base_type* task = end;
@@ -204,12 +225,21 @@ class TaskQueueSpecializationConstrained<
         }
       }
 
+      if (trace) trace->count_pop();
+
       if (end != task) {
         // pop_ready_task resulted in lock == task->m_next
         // In the executing state
 
+        if (trace) {
+          trace->begin_execute();
+          trace->sample_depth(queue->m_ready_count);
+        }
+
         (*task->m_apply)(task, &exec);
 
+        if (trace) trace->end_execute();
+
 #if 0
         printf( "TaskQueue<Serial>::executed: 0x%lx { 0x%lx 0x%lx %d %d %d }\n"
         , uintptr_t(task)
@@ -223,10 +253,14 @@ class TaskQueueSpecializationConstrained<
         // If a respawn then re-enqueue otherwise the task is complete
         // and all tasks waiting on this task are updated.
         queue->complete(task);
+
+        if (trace) trace->end_complete();
       } else if (0 != queue->m_ready_count) {
         Kokkos::abort("TaskQueue<Serial>::execute ERROR: ready_count");
       }
     }
+
+    if (trace) trace->stop();
   }
 
   template <typename TaskType>
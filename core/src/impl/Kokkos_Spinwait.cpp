@@ -49,6 +49,17 @@
 #include <impl/Kokkos_Spinwait.hpp>
 #include <impl/Kokkos_BitOps.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #if defined(KOKKOS_ENABLE_STDTHREAD) || defined(_WIN32)
 #include <thread>
 #elif !defined(_WIN32)
@@ -151,6 +162,75 @@ void host_thread_yield(const uint32_t i, const WaitMode mode) {
 #endif /* defined( KOKKOS_ENABLE_ASM ) */
 }
 
+namespace {
+
+int64_t read_spin_nanoseconds() {
+  char const* const env = std::getenv("KOKKOS_SPIN_WAIT_US");
+  const int usec        = env != nullptr ? std::max(0, std::atoi(env)) : 100;
+  return 1000 * int64_t(usec);
+}
+
+}  // namespace
+
+int64_t host_thread_spin_nanoseconds() {
+  static const int64_t nanoseconds = read_spin_nanoseconds();
+  return nanoseconds;
+}
+
+bool host_thread_spin(bool (*done)(const void*), const void* arg) {
+  typedef std::chrono::steady_clock clock;
+
+  if ((*done)(arg)) return true;
+
+  const int64_t limit = host_thread_spin_nanoseconds();
+
+  if (limit <= 0) return false;
+
+  const clock::time_point end = clock::now() + std::chrono::nanoseconds(limit);
+
+  for (uint32_t i = 1; !(*done)(arg); ++i) {
+    if (0 == i % 64) {
+      // Check the clock and give up the core in case it is oversubscribed
+      if (end < clock::now()) return (*done)(arg);
+#if defined(KOKKOS_ENABLE_STDTHREAD) || defined(_WIN32)
+      std::this_thread::yield();
+#else
+      sched_yield();
+#endif
+    } else {
+      host_thread_yield(1, WaitMode::ROOT);  // pause
+    }
+  }
+  return true;
+}
+
+void host_thread_block(int volatile* addr, const int value) {
+#if defined(__linux__)
+  syscall(SYS_futex, const_cast<int*>(addr), FUTEX_WAIT_PRIVATE, value,
+          nullptr, nullptr, 0);
+#else
+  if (value == *addr) {
+#if defined(KOKKOS_ENABLE_STDTHREAD) || defined(_WIN32)
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+#else
+    timespec req;
+    req.tv_sec  = 0;
+    req.tv_nsec = 50000;
+    nanosleep(&req, nullptr);
+#endif
+  }
+#endif
+}
+
+void host_thread_wake_all(int volatile* addr) {
+#if defined(__linux__)
+  syscall(SYS_futex, const_cast<int*>(addr), FUTEX_WAKE_PRIVATE, INT_MAX,
+          nullptr, nullptr, 0);
+#else
+  (void)addr;
+#endif
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -65,6 +65,38 @@ enum class WaitMode : int {
 
 void host_thread_yield(const uint32_t i, const WaitMode mode);
 
+/** \brief  Nanoseconds a hybrid wait spins before it blocks the thread.
+ *
+ *  Read once from the KOKKOS_SPIN_WAIT_US environment variable, given
+ *  in microseconds, and defaults to 100.  Zero blocks right away.
+ */
+int64_t host_thread_spin_nanoseconds();
+
+/** \brief  Spin, yielding now and then, until 'done(arg)' is true or the
+ *          spin interval elapses.  Returns the final 'done(arg)'.
+ */
+bool host_thread_spin(bool (*done)(const void*), const void* arg);
+
+/** \brief  Block the calling thread while '*addr == value'.
+ *
+ *  Uses a futex where available and a short sleep otherwise.
+ *  May return spuriously, callers must recheck their condition.
+ */
+void host_thread_block(int volatile* addr, const int value);
+
+/** \brief  Wake all threads blocked on 'addr'. */
+void host_thread_wake_all(int volatile* addr);
+
+template <class Done>
+bool host_thread_spin_apply(const void* done) {
+  return (*static_cast<const Done*>(done))();
+}
+
+template <class Done>
+bool host_thread_spin(const Done& done) {
+  return host_thread_spin(&host_thread_spin_apply<Done>, &done);
+}
+
 template <typename T>
 typename std::enable_if<std::is_integral<T>::value, void>::type
 root_spinwait_while_equal(T const volatile& flag, const T value) {
@@ -0,0 +1,223 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Macros.hpp>
+#if defined(KOKKOS_ENABLE_TASKDAG)
+
+#include <impl/Kokkos_TaskTracer.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+struct TaskTracerState {
+  bool enabled;
+  bool environment_checked;
+  int active;
+  int64_t epoch;
+  std::string filename;
+  std::vector<std::unique_ptr<TaskTraceWorker> > workers;
+
+  TaskTracerState()
+      : enabled(false),
+        environment_checked(false),
+        active(0),
+        epoch(0),
+        filename(),
+        workers() {}
+};
+
+TaskTracerState& tracer_state() {
+  static TaskTracerState state;
+  return state;
+}
+
+void check_environment(TaskTracerState& state) {
+  if (!state.environment_checked) {
+    state.environment_checked = true;
+    char const* const env = std::getenv("KOKKOS_TASK_TRACE");
+    if (env != nullptr && !state.enabled) TaskTracer::enable(env);
+  }
+}
+
+const char* phase_name(int phase) {
+  switch (phase) {
+    case TaskTraceWorker::Idle: return "idle";
+    case TaskTraceWorker::Execute: return "execute";
+    case TaskTraceWorker::Complete: return "complete";
+    default: return "unknown";
+  }
+}
+
+}  // namespace
+
+bool TaskTracer::is_enabled() noexcept { return tracer_state().enabled; }
+
+void TaskTracer::enable(std::string const& filename) {
+  TaskTracerState& state    = tracer_state();
+  state.environment_checked = true;
+  state.enabled             = true;
+  state.filename            = filename;
+  state.epoch               = TaskTraceWorker::clock();
+  state.active              = 0;
+  for (auto& w : state.workers) w->clear(state.epoch);
+}
+
+void TaskTracer::disable() {
+  TaskTracerState& state = tracer_state();
+  if (!state.enabled) return;
+
+  if (!state.filename.empty()) {
+    std::ofstream out(state.filename.c_str());
+    if (out) {
+      write_chrome_trace(out);
+    } else {
+      std::cerr << "Kokkos::Impl::TaskTracer WARNING: could not open '"
+                << state.filename << "' for writing" << std::endl;
+    }
+  }
+
+  state.enabled = false;
+  state.active  = 0;
+  state.workers.clear();
+}
+
+bool TaskTracer::begin_execute(int pool_size) {
+  TaskTracerState& state = tracer_state();
+  check_environment(state);
+  if (!state.enabled) return false;
+
+  while (int(state.workers.size()) < pool_size) {
+    state.workers.emplace_back(new TaskTraceWorker());
+    state.workers.back()->clear(state.epoch);
+  }
+  state.active = pool_size;
+  return true;
+}
+
+TaskTraceWorker* TaskTracer::worker(int rank) noexcept {
+  TaskTracerState& state = tracer_state();
+  return (state.enabled && 0 <= rank && rank < state.active)
+             ? state.workers[rank].get()
+             : nullptr;
+}
+
+TaskTracer::Statistics TaskTracer::statistics() {
+  Statistics stats = {0, 0, 0, 0, 0, 0.0, 0.0, 0.0};
+  for (auto const& w : tracer_state().workers) {
+    stats.task_count += w->m_task_count;
+    stats.pop_attempt += w->m_pop_attempt;
+    stats.steal_attempt += w->m_steal_attempt;
+    stats.steal_success += w->m_steal_success;
+    for (auto const& s : w->m_depth) {
+      if (stats.max_depth < s.depth) stats.max_depth = s.depth;
+    }
+    stats.idle_seconds += 1.0e-9 * w->m_phase_time[TaskTraceWorker::Idle];
+    stats.execute_seconds +=
+        1.0e-9 * w->m_phase_time[TaskTraceWorker::Execute];
+    stats.complete_seconds +=
+        1.0e-9 * w->m_phase_time[TaskTraceWorker::Complete];
+  }
+  return stats;
+}
+
+void TaskTracer::write_chrome_trace(std::ostream& out) {
+  TaskTracerState& state = tracer_state();
+
+  // Chrome trace-event timestamps and durations are in microseconds
+  const auto usec = [](int64_t ns) { return 1.0e-3 * double(ns); };
+
+  out << "{\"traceEvents\":[";
+  const char* sep = "\n";
+
+  for (int rank = 0; rank < int(state.workers.size()); ++rank) {
+    TaskTraceWorker const& w = *state.workers[rank];
+
+    out << sep << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+        << rank << ",\"args\":{\"name\":\"task worker " << rank << "\"}}";
+    sep = ",\n";
+
+    for (auto const& s : w.m_spans) {
+      out << sep << "{\"name\":\"" << phase_name(s.phase)
+          << "\",\"cat\":\"task\",\"ph\":\"X\",\"pid\":0,\"tid\":" << rank
+          << ",\"ts\":" << usec(s.begin) << ",\"dur\":" << usec(s.end - s.begin)
+          << "}";
+    }
+
+    for (auto const& d : w.m_depth) {
+      out << sep
+          << "{\"name\":\"ready_depth\",\"ph\":\"C\",\"pid\":0,\"tid\":" << rank
+          << ",\"ts\":" << usec(d.time) << ",\"args\":{\"depth\":" << d.depth
+          << "}}";
+    }
+
+    out << sep << "{\"name\":\"worker_statistics\",\"ph\":\"M\",\"pid\":0,"
+        << "\"tid\":" << rank << ",\"args\":{\"tasks\":" << w.m_task_count
+        << ",\"pop_attempts\":" << w.m_pop_attempt
+        << ",\"steal_attempts\":" << w.m_steal_attempt
+        << ",\"steals\":" << w.m_steal_success
+        << ",\"idle_us\":" << usec(w.m_phase_time[TaskTraceWorker::Idle])
+        << ",\"execute_us\":" << usec(w.m_phase_time[TaskTraceWorker::Execute])
+        << ",\"complete_us\":"
+        << usec(w.m_phase_time[TaskTraceWorker::Complete]) << "}}";
+  }
+
+  out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#else
+void KOKKOS_CORE_SRC_IMPL_TASKTRACER_PREVENT_LINK_ERROR() {}
+#endif /* #if defined( KOKKOS_ENABLE_TASKDAG ) */
@@ -0,0 +1,207 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_TASKTRACER_HPP
+#define KOKKOS_IMPL_TASKTRACER_HPP
+
+#include <Kokkos_Macros.hpp>
+#if defined(KOKKOS_ENABLE_TASKDAG)
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Per-worker record of a traced host task queue execution.
+ *
+ *  A worker's timeline is partitioned into contiguous phases: idle
+ *  (searching the ready queues), executing a task, and completing a task
+ *  (respawn and dependence resolution).  Each phase ends at the time the
+ *  next one begins, so only one timestamp is taken per transition.
+ *  A record is only ever modified by its owning worker thread.
+ */
+class TaskTraceWorker {
+ public:
+  enum Phase : int { Idle = 0, Execute = 1, Complete = 2, NumPhase = 3 };
+
+  struct Span {
+    int64_t begin;  // nanoseconds since the tracer epoch
+    int64_t end;
+    int phase;
+  };
+
+  struct DepthSample {
+    int64_t time;
+    int32_t depth;
+  };
+
+  std::vector<Span> m_spans;
+  std::vector<DepthSample> m_depth;
+  int64_t m_phase_time[NumPhase];
+  int64_t m_mark;
+  int64_t m_epoch;
+  uint64_t m_task_count;
+  uint64_t m_pop_attempt;
+  uint64_t m_steal_attempt;
+  uint64_t m_steal_success;
+  int32_t m_last_depth;
+
+  TaskTraceWorker() { clear(0); }
+
+  void clear(int64_t epoch) noexcept {
+    m_spans.clear();
+    m_depth.clear();
+    for (int i = 0; i < NumPhase; ++i) m_phase_time[i] = 0;
+    m_mark          = 0;
+    m_epoch         = epoch;
+    m_task_count    = 0;
+    m_pop_attempt   = 0;
+    m_steal_attempt = 0;
+    m_steal_success = 0;
+    m_last_depth    = -1;
+  }
+
+  static int64_t clock() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  /**\brief  Start the worker's timeline in the idle phase */
+  void start() noexcept { m_mark = clock() - m_epoch; }
+
+  /**\brief  Close the current phase and begin the next */
+  void transition(Phase closing) {
+    const int64_t now = clock() - m_epoch;
+    if (m_mark < now) {
+      m_phase_time[closing] += now - m_mark;
+      m_spans.push_back(Span{m_mark, now, int(closing)});
+    }
+    m_mark = now;
+  }
+
+  void begin_execute() {
+    ++m_task_count;
+    transition(Idle);
+  }
+  void end_execute() { transition(Execute); }
+  void end_complete() { transition(Complete); }
+  void stop() { transition(Idle); }
+
+  void count_pop() noexcept { ++m_pop_attempt; }
+
+  void count_steal(bool success) noexcept {
+    ++m_steal_attempt;
+    if (success) ++m_steal_success;
+  }
+
+  /**\brief  Record the ready-queue depth if it changed since the last sample
+   */
+  void sample_depth(int32_t depth) {
+    if (depth != m_last_depth) {
+      m_depth.push_back(DepthSample{m_mark, depth});
+      m_last_depth = depth;
+    }
+  }
+};
+
+/** \brief  Optional instrumentation of host task-DAG execution.
+ *
+ *  Tracing is disabled by default.  It is enabled at run time either by
+ *  setting the KOKKOS_TASK_TRACE environment variable to an output file
+ *  name or by calling TaskTracer::enable().  While enabled, the host
+ *  task queue specializations record one TaskTraceWorker per pool rank.
+ *  The accumulated trace is written in Chrome trace-event JSON format
+ *  by TaskTracer::disable(), which Kokkos::finalize() calls.
+ */
+class TaskTracer {
+ public:
+  struct Statistics {
+    uint64_t task_count;
+    uint64_t pop_attempt;
+    uint64_t steal_attempt;
+    uint64_t steal_success;
+    int32_t max_depth;
+    double idle_seconds;
+    double execute_seconds;
+    double complete_seconds;
+  };
+
+  static bool is_enabled() noexcept;
+
+  /**\brief  Enable tracing.  An empty file name collects statistics only. */
+  static void enable(std::string const& filename);
+
+  /**\brief  Write the trace file, if any, and disable tracing. */
+  static void disable();
+
+  /**\brief  Prepare worker records for a task queue execution.
+   *
+   *  Must be called by the master thread before entering the parallel
+   *  region.  Returns false if tracing is disabled.
+   */
+  static bool begin_execute(int pool_size);
+
+  /**\brief  Worker record for the given pool rank; nullptr if disabled. */
+  static TaskTraceWorker* worker(int rank) noexcept;
+
+  /**\brief  Statistics accumulated over all workers since enable(). */
+  static Statistics statistics();
+
+  /**\brief  Write accumulated trace events to a stream. */
+  static void write_chrome_trace(std::ostream& out);
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* #if defined( KOKKOS_ENABLE_TASKDAG ) */
+#endif /* #ifndef KOKKOS_IMPL_TASKTRACER_HPP */
@@ -50,8 +50,11 @@
 #include <stdexcept>
 #include <sstream>
 #include <iostream>
+#include <vector>
 
+#include <Kokkos_Core.hpp>
 #include <impl/Kokkos_ConcurrentBitset.hpp>
+#include <impl/Kokkos_Timer.hpp>
 
 namespace Test {
 
@@ -164,6 +167,170 @@ void test_concurrent_bitset(int bit_count) {
   ASSERT_EQ(total_release, total_reacquire);
 }
 
+template <class DeviceType, bool Summary>
+struct ConcurrentBitsetFill {
+  typedef Kokkos::View<uint32_t*, DeviceType> view_unsigned_type;
+  typedef Kokkos::View<int*, DeviceType> view_int_type;
+
+  view_unsigned_type bitset;
+  view_int_type acquired;
+  uint32_t bit_count;
+
+  ConcurrentBitsetFill(const uint32_t arg_bit_count,
+                       const view_unsigned_type& arg_bitset,
+                       const view_int_type& arg_acquired)
+      : bitset(arg_bitset), acquired(arg_acquired), bit_count(arg_bit_count) {}
+
+  struct TagAcquire {};
+  struct TagCycle {};
+
+  KOKKOS_INLINE_FUNCTION
+  int acquire() const {
+    const unsigned hint = Kokkos::Impl::clock_tic() % bit_count;
+
+    return Summary ? Kokkos::Impl::concurrent_bitset::acquire_summary_bounded(
+                         bitset.data(), bit_count, hint)
+                         .first
+                   : Kokkos::Impl::concurrent_bitset::acquire_bounded(
+                         bitset.data(), bit_count, hint)
+                         .first;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void release(const int bit) const {
+    if (Summary) {
+      Kokkos::Impl::concurrent_bitset::release_summary(bitset.data(),
+                                                       bit_count, bit);
+    } else {
+      Kokkos::Impl::concurrent_bitset::release(bitset.data(), bit);
+    }
+  }
+
+  // Acquire and keep
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagAcquire, int i, long& update) const {
+    acquired(i) = acquire();
+
+    if (0 <= acquired(i)) ++update;
+  }
+
+  // Acquire and release again, holding the fill ratio steady
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagCycle, int, long& update) const {
+    const int bit = acquire();
+
+    if (0 <= bit) {
+      release(bit);
+      ++update;
+    }
+  }
+};
+
+// Acquire latency of the plain and of the summarized bitset
+// as the bitset fills up.
+template <class DeviceType, bool Summary>
+void test_concurrent_bitset_fill(const uint32_t bit_count,
+                                 const bool print_statistics) {
+  typedef ConcurrentBitsetFill<DeviceType, Summary> Functor;
+  typedef typename Functor::view_unsigned_type view_unsigned_type;
+  typedef typename Functor::view_int_type view_int_type;
+
+  const int fill_percent[] = {0, 50, 75, 90, 95, 99};
+
+  const long cycle_count = 4 * long(bit_count);
+
+  view_unsigned_type bitset(
+      "bitset",
+      Kokkos::Impl::concurrent_bitset::summary_buffer_bound(bit_count));
+
+  view_int_type acquired("acquired", bit_count);
+
+  typename view_unsigned_type::HostMirror bitset_host =
+      Kokkos::create_mirror_view(bitset);
+
+  for (int k = 0; k < int(sizeof(fill_percent) / sizeof(int)); ++k) {
+    const long fill_count = (long(bit_count) * fill_percent[k]) / 100;
+
+    long total = 0;
+    long cycle = 0;
+
+    Kokkos::deep_copy(bitset, 0u);
+
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<DeviceType, typename Functor::TagAcquire>(
+            0, fill_count),
+        Functor(bit_count, bitset, acquired), total);
+
+    ASSERT_EQ(fill_count, total);
+
+    Kokkos::Timer timer;
+
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<DeviceType, typename Functor::TagCycle>(
+            0, cycle_count),
+        Functor(bit_count, bitset, acquired), cycle);
+
+    const double time = timer.seconds();
+
+    // May only run out of bits if all in flight cycles can exhaust them
+    if (fill_count + DeviceType::concurrency() <= long(bit_count)) {
+      ASSERT_EQ(cycle_count, cycle);
+    } else {
+      ASSERT_LE(cycle, cycle_count);
+    }
+
+    Kokkos::deep_copy(bitset_host, bitset);
+
+    ASSERT_EQ(uint32_t(fill_count),
+              bitset_host(0) &
+                  Kokkos::Impl::concurrent_bitset::state_used_mask);
+
+    if (print_statistics) {
+      std::cout << "concurrent_bitset" << (Summary ? " summary" : "")
+                << " bits(" << bit_count << ") fill(" << fill_percent[k]
+                << "%) acquire+release(" << 1.0e9 * time / cycle_count
+                << " ns)" << std::endl;
+    }
+  }
+
+  // Acquire more than available, no bit is handed out twice:
+
+  Kokkos::deep_copy(bitset, 0u);
+
+  long total = 0;
+
+  view_int_type acquired_over("acquired_over", bit_count + bit_count / 2);
+
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<DeviceType, typename Functor::TagAcquire>(
+          0, acquired_over.extent(0)),
+      Functor(bit_count, bitset, acquired_over), total);
+
+  ASSERT_EQ(long(bit_count), total);
+
+  typename view_int_type::HostMirror acquired_host =
+      Kokkos::create_mirror_view(acquired_over);
+
+  Kokkos::deep_copy(acquired_host, acquired_over);
+
+  std::vector<int> claimed(bit_count, 0);
+
+  for (size_t i = 0; i < acquired_host.extent(0); ++i) {
+    if (0 <= acquired_host(i)) {
+      ASSERT_LT(acquired_host(i), int(bit_count));
+      ASSERT_EQ(0, claimed[acquired_host(i)]++);
+    }
+  }
+}
+
+TEST(TEST_CATEGORY, concurrent_bitset) {
+  test_concurrent_bitset<TEST_EXECSPACE>(1 << 10);
+  test_concurrent_bitset_fill<TEST_EXECSPACE, false>(1 << 14, false);
+  test_concurrent_bitset_fill<TEST_EXECSPACE, true>(1 << 14, false);
+  // bit count which is not a multiple of the word size
+  test_concurrent_bitset_fill<TEST_EXECSPACE, true>(1000, false);
+}
+
 }  // namespace Test
 
 #endif /* #ifndef TEST_CONCURRENTBITSET_HPP */
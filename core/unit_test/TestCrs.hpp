@@ -42,6 +42,8 @@
 //@HEADER
 */
 
+#include <algorithm>
+#include <set>
 #include <vector>
 
 #include <Kokkos_Core.hpp>
@@ -199,6 +201,79 @@ void test_constructor(std::int32_t nrows) {
   }
 }
 
+// Build a graph from unsorted coordinates with duplicates, check it
+// against std::set, then check its transpose
+template <class ExecSpace>
+void test_coo_transpose(std::int32_t nrows) {
+  typedef Kokkos::Crs<std::int32_t, ExecSpace, void, std::int32_t> crs_type;
+  typedef Kokkos::View<std::int32_t*, ExecSpace> coords_type;
+  typedef Kokkos::View<std::int32_t*, Kokkos::HostSpace,
+                       Kokkos::MemoryUnmanaged>
+      host_coords_type;
+
+  std::vector<std::set<std::int32_t> > expected(nrows);
+  std::vector<std::set<std::int32_t> > expected_transpose(nrows);
+  std::vector<std::int32_t> h_rows, h_cols;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (std::int32_t row = nrows - 1; 0 <= row; --row) {
+      for (std::int32_t k = row % 4; 0 <= k; --k) {
+        const std::int32_t col = (3 * row + 5 * k) % nrows;
+        h_rows.push_back(row);
+        h_cols.push_back(col);
+        expected[row].insert(col);
+        expected_transpose[col].insert(row);
+      }
+    }
+  }
+  // A long row to sort
+  for (std::int32_t k = 0; k < nrows / 10; ++k) {
+    const std::int32_t col = (7 * k) % nrows;
+    h_rows.push_back(nrows / 2);
+    h_cols.push_back(col);
+    expected[nrows / 2].insert(col);
+    expected_transpose[col].insert(nrows / 2);
+  }
+
+  coords_type rows("rows", h_rows.size());
+  coords_type cols("cols", h_cols.size());
+  Kokkos::deep_copy(rows, host_coords_type(h_rows.data(), h_rows.size()));
+  Kokkos::deep_copy(cols, host_coords_type(h_cols.data(), h_cols.size()));
+
+  crs_type graph;
+  Kokkos::coo_to_crs(graph, nrows, rows, cols);
+  ASSERT_EQ(graph.numRows(), nrows);
+  {
+    auto row_map = Kokkos::create_mirror_view(graph.row_map);
+    Kokkos::deep_copy(row_map, graph.row_map);
+    auto entries = Kokkos::create_mirror_view(graph.entries);
+    Kokkos::deep_copy(entries, graph.entries);
+    for (std::int32_t row = 0; row < nrows; ++row) {
+      ASSERT_EQ(std::size_t(row_map(row + 1) - row_map(row)),
+                expected[row].size());
+      ASSERT_TRUE(std::equal(expected[row].begin(), expected[row].end(),
+                             entries.data() + row_map(row)));
+    }
+  }
+
+  crs_type transpose;
+  Kokkos::transpose_crs(transpose, graph);
+  ASSERT_EQ(transpose.numRows(), nrows);
+  {
+    auto row_map = Kokkos::create_mirror_view(transpose.row_map);
+    Kokkos::deep_copy(row_map, transpose.row_map);
+    auto entries = Kokkos::create_mirror_view(transpose.entries);
+    Kokkos::deep_copy(entries, transpose.entries);
+    for (std::int32_t row = 0; row < nrows; ++row) {
+      std::vector<std::int32_t> found(entries.data() + row_map(row),
+                                      entries.data() + row_map(row + 1));
+      std::sort(found.begin(), found.end());
+      ASSERT_EQ(found.size(), expected_transpose[row].size());
+      ASSERT_TRUE(std::equal(found.begin(), found.end(),
+                             expected_transpose[row].begin()));
+    }
+  }
+}
+
 }  // anonymous namespace
 
 TEST(TEST_CATEGORY, crs_count_fill) {
@@ -212,6 +287,14 @@ TEST(TEST_CATEGORY, crs_count_fill) {
   test_count_fill<TEST_EXECSPACE>(10000);
 }
 
+TEST(TEST_CATEGORY, crs_coo_transpose) {
+  test_coo_transpose<TEST_EXECSPACE>(0);
+  test_coo_transpose<TEST_EXECSPACE>(1);
+  test_coo_transpose<TEST_EXECSPACE>(13);
+  test_coo_transpose<TEST_EXECSPACE>(1000);
+  test_coo_transpose<TEST_EXECSPACE>(10000);
+}
+
 TEST(TEST_CATEGORY, crs_copy_constructor) {
   test_constructor<TEST_EXECSPACE>(0);
   test_constructor<TEST_EXECSPACE>(1);
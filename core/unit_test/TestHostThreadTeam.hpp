@@ -0,0 +1,227 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_HOSTTHREADTEAM_HPP
+#define TEST_HOSTTHREADTEAM_HPP
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_HostThreadTeam.hpp>
+
+namespace Test {
+
+namespace {
+
+// A pool of HostThreadTeamData with synthetic (NUMA,core) coordinates,
+// organized by the calling thread only.
+struct TestHostThreadTeamPool {
+  typedef Kokkos::Impl::HostThreadTeamData data_type;
+
+  std::vector<data_type> m_data;
+  std::vector<data_type*> m_members;
+  std::vector<std::vector<int64_t> > m_scratch;
+
+  explicit TestHostThreadTeamPool(const int size)
+      : m_data(size), m_members(size), m_scratch(size) {
+    const size_t bytes = data_type::scratch_size(0, 0, 0, 0);
+    for (int i = 0; i < size; ++i) {
+      m_scratch[i].resize(bytes / sizeof(int64_t));
+      m_data[i].scratch_assign(m_scratch[i].data(), bytes, 0, 0, 0, 0);
+      m_members[i] = &m_data[i];
+    }
+  }
+
+  ~TestHostThreadTeamPool() {
+    for (size_t i = 0; i < m_data.size(); ++i) m_data[i].disband_pool();
+  }
+
+  void organize() {
+    data_type::organize_pool(m_members.data(), int(m_members.size()));
+  }
+
+  // Ranks visited by 'rank' in work stealing order
+  std::vector<int> steal_order(const int rank) {
+    data_type& data = m_data[rank];
+    std::vector<int> order;
+
+    // Positions the first victim like the start of a kernel
+    data.set_work_partition(int64_t(m_data.size()), 1);
+    if (data.steal_rank() != rank) {
+      order.push_back(data.steal_rank());
+      while (data.next_steal_rank()) order.push_back(data.steal_rank());
+    }
+    // Exhausted, back at its own rank
+    EXPECT_EQ(data.steal_rank(), rank);
+    EXPECT_FALSE(data.next_steal_rank());
+    return order;
+  }
+
+  // Nearest level first, round robin after 'rank' within a level
+  std::vector<int> expected_order(const int rank) const {
+    const int size = int(m_data.size());
+    std::vector<std::pair<int, int> > key;
+    for (int i = 0; i < size; ++i) {
+      if (i != rank) {
+        key.push_back(std::make_pair(m_data[rank].steal_level(m_data[i]),
+                                     (i - rank + size) % size));
+      }
+    }
+    std::sort(key.begin(), key.end());
+    std::vector<int> order;
+    for (size_t i = 0; i < key.size(); ++i) {
+      order.push_back((key[i].second + rank) % size);
+    }
+    return order;
+  }
+};
+
+}  // namespace
+
+TEST(TEST_CATEGORY, host_thread_team_steal_order) {
+  // Two NUMA regions of two cores with two hyperthreads each
+  {
+    TestHostThreadTeamPool pool(8);
+    for (int i = 0; i < 8; ++i) {
+      pool.m_data[i].set_thread_coordinate(
+          std::pair<unsigned, unsigned>(i / 4, (i / 2) % 2));
+    }
+    pool.organize();
+
+    // Hyperthread sibling, then the same NUMA region, then the rest
+    const int order_of_5[] = {4, 6, 7, 0, 1, 2, 3};
+    const std::vector<int> order = pool.steal_order(5);
+    ASSERT_EQ(order, std::vector<int>(order_of_5, order_of_5 + 7));
+
+    for (int rank = 0; rank < 8; ++rank) {
+      ASSERT_EQ(pool.steal_order(rank), pool.expected_order(rank));
+    }
+  }
+
+  // Unknown coordinates are all remote, visited round robin
+  {
+    TestHostThreadTeamPool pool(5);
+    pool.organize();
+
+    for (int rank = 0; rank < 5; ++rank) {
+      const std::vector<int> order = pool.steal_order(rank);
+      ASSERT_EQ(order.size(), 4u);
+      for (int i = 0; i < 4; ++i) ASSERT_EQ(order[i], (rank + 1 + i) % 5);
+    }
+  }
+
+  // A pool of one has no one to steal from
+  {
+    TestHostThreadTeamPool pool(1);
+    pool.m_data[0].set_thread_coordinate(std::pair<unsigned, unsigned>(0, 0));
+    pool.organize();
+    ASSERT_TRUE(pool.steal_order(0).empty());
+  }
+}
+
+TEST(TEST_CATEGORY, host_thread_team_guided_chunks) {
+  TestHostThreadTeamPool pool(4);
+  pool.organize();
+
+  Kokkos::Impl::HostThreadTeamData& data = pool.m_data[0];
+
+  const int64_t length    = 10000;
+  const int64_t min_chunk = 16;
+  data.set_work_partition(length, 1);
+
+  // Chunks are claimed in order and shrink with the remaining work
+  // down to the minimum chunk size
+  int64_t next = 0;
+  int64_t prev = length;
+  std::pair<int64_t, int64_t> range;
+  while (0 <= (range = data.get_work_guided_chunk(min_chunk)).first) {
+    const int64_t n = range.second - range.first;
+    ASSERT_EQ(range.first, next);
+    ASSERT_LE(n, prev);
+    ASSERT_TRUE(min_chunk <= n || range.second == length);
+    if (min_chunk < prev) {
+      ASSERT_LT(n, prev);
+    }
+    next = range.second;
+    prev = n;
+  }
+  ASSERT_EQ(next, length);
+  ASSERT_LE(prev, min_chunk);
+}
+
+TEST(TEST_CATEGORY, host_adaptive_chunk) {
+  Kokkos::Impl::HostAdaptiveChunk adaptive;
+
+  const int64_t length = 4096;
+  const int64_t chunk  = 64;
+
+  ASSERT_EQ(adaptive.current(), 0);
+  ASSERT_EQ(adaptive.chunk_size(chunk), chunk);
+
+  // Imbalanced launches halve the chunk
+  adaptive.update(chunk, length, 4, 4 * 50, 100);
+  ASSERT_EQ(adaptive.current(), chunk / 2);
+
+  // A launch which used an outdated chunk does not update it
+  adaptive.update(chunk, length, 4, 4 * 50, 100);
+  ASSERT_EQ(adaptive.current(), chunk / 2);
+
+  // Balanced launches double the chunk up to a quarter share per member
+  adaptive.update(chunk / 2, length, 4, 4 * 100, 100);
+  ASSERT_EQ(adaptive.current(), chunk);
+  adaptive.update(chunk, 16 * chunk, 4, 4 * 100, 100);
+  ASSERT_EQ(adaptive.current(), chunk);
+
+  // A single member is never imbalanced
+  adaptive.update(chunk, length, 1, 50, 100);
+  ASSERT_EQ(adaptive.current(), chunk);
+}
+
+}  // namespace Test
+
+#endif
@@ -43,10 +43,14 @@
 */
 
 #include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <Kokkos_Core.hpp>
+#include <impl/Kokkos_HostMDRangeTuner.hpp>
 
 namespace Test {
 
@@ -3675,6 +3679,361 @@ struct TestMDRange_6D_NegIdx {
   }
 };
 
+template <typename ExecSpace>
+struct TestMDRange_3D_Tune {
+  using DataType     = int;
+  using ViewType     = typename Kokkos::View<DataType ***, ExecSpace>;
+  using HostViewType = typename ViewType::HostMirror;
+
+  ViewType input_view;
+
+  TestMDRange_3D_Tune(const DataType N0, const DataType N1, const DataType N2)
+      : input_view("input_view", N0, N1, N2) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    input_view(i, j, k) += 1;
+  }
+
+  static void test_tune3(const int N0, const int N1, const int N2) {
+    typedef typename Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<3>,
+                                           Kokkos::IndexType<int> >
+        range_type;
+    typedef typename range_type::point_type point_type;
+    typedef Kokkos::Impl::HostMDRangeTuner tuner_type;
+
+    // Tiles are left to the default so host backends tune them
+    range_type range(point_type{{0, 0, 0}}, point_type{{N0, N1, N2}});
+
+    TestMDRange_3D_Tune functor(N0, N1, N2);
+
+    const std::string key =
+        Kokkos::Impl::HostMDRangeTunedLaunch<range_type>::template key<
+            TestMDRange_3D_Tune>(range);
+    // Written to the temporary directory, one file per backend
+    char const* tmpdir = std::getenv("TMPDIR");
+    if (tmpdir == nullptr) tmpdir = std::getenv("TEMP");
+    if (tmpdir == nullptr) tmpdir = "/tmp";
+    const std::string filename = std::string(tmpdir) +
+                                 "/kokkos_mdrange_tune_test_" +
+                                 ExecSpace::name() + ".txt";
+
+    const int explore  = 12;
+    const int launches = 16;
+
+    long tile[3]  = {0, 0, 0};
+    long saved[3] = {0, 0, 0};
+
+    tuner_type::enable(explore, filename);
+    for (int l = 0; l < launches; ++l) {
+      parallel_for(range, functor);
+    }
+    const bool settled = tuner_type::settled_tile(key, 3, tile);
+    tuner_type::disable();
+
+    // The settled tile is restored from the file without exploring
+    bool restored = false;
+    if (settled) {
+      tuner_type::enable(explore, filename);
+      parallel_for(range, functor);
+      restored = tuner_type::settled_tile(key, 3, saved);
+      tuner_type::disable();
+    }
+    std::remove(filename.c_str());
+
+    // Only host backends tune
+    ASSERT_EQ(settled, range.m_tune_tiles);
+
+    if (settled) {
+      ASSERT_TRUE(0 < tile[0] && tile[0] <= N0);
+      ASSERT_TRUE(0 < tile[1] && tile[1] <= N1);
+      ASSERT_TRUE(0 < tile[2] && tile[2] <= N2);
+
+      ASSERT_TRUE(restored);
+      ASSERT_EQ(saved[0], tile[0]);
+      ASSERT_EQ(saved[1], tile[1]);
+      ASSERT_EQ(saved[2], tile[2]);
+    } else {
+      parallel_for(range, functor);
+    }
+
+    HostViewType h_view = Kokkos::create_mirror_view(functor.input_view);
+    Kokkos::deep_copy(h_view, functor.input_view);
+
+    int counter = 0;
+    for (int i = 0; i < N0; ++i) {
+      for (int j = 0; j < N1; ++j) {
+        for (int k = 0; k < N2; ++k) {
+          if (h_view(i, j, k) != launches + 1) {
+            ++counter;
+          }
+        }
+      }
+    }
+
+    ASSERT_EQ(counter, 0);
+  }
+};
+
+template <typename ExecSpace>
+struct TestMDRange_3D_Curve {
+  using value_type = double;
+
+  using DataType     = int;
+  using ViewType     = typename Kokkos::View<DataType ***, ExecSpace>;
+  using HostViewType = typename ViewType::HostMirror;
+
+  ViewType input_view;
+
+  TestMDRange_3D_Curve(const DataType N0, const DataType N1, const DataType N2)
+      : input_view("input_view", N0, N1, N2) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    input_view(i, j, k) += 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k,
+                  value_type &lsum) const {
+    lsum += input_view(i, j, k) * 2;
+  }
+
+  template <Kokkos::Iterate OuterDir, class Schedule>
+  static void test_curve(const int N0, const int N1, const int N2) {
+    typedef typename Kokkos::MDRangePolicy<
+        ExecSpace, Kokkos::Rank<3, OuterDir, Kokkos::Iterate::Right>,
+        Kokkos::IndexType<int>, Kokkos::Schedule<Schedule> >
+        range_type;
+    typedef typename range_type::tile_type tile_type;
+    typedef typename range_type::point_type point_type;
+
+    // Tile grid is not a power of two in any dimension
+    range_type range(point_type{{0, 0, 0}}, point_type{{N0, N1, N2}},
+                     tile_type{{3, 5, 7}});
+
+    TestMDRange_3D_Curve functor(N0, N1, N2);
+
+    parallel_for(range, functor);
+
+    double sum = 0.0;
+    parallel_reduce(range, functor, sum);
+
+    ASSERT_EQ(sum, 2 * N0 * N1 * N2);
+
+    HostViewType h_view = Kokkos::create_mirror_view(functor.input_view);
+    Kokkos::deep_copy(h_view, functor.input_view);
+
+    int counter = 0;
+    for (int i = 0; i < N0; ++i) {
+      for (int j = 0; j < N1; ++j) {
+        for (int k = 0; k < N2; ++k) {
+          if (h_view(i, j, k) != 1) {
+            ++counter;
+          }
+        }
+      }
+    }
+
+    ASSERT_EQ(counter, 0);
+  }
+
+  static void test_curve3(const int N0, const int N1, const int N2) {
+    test_curve<Kokkos::Iterate::Morton, Kokkos::Static>(N0, N1, N2);
+    test_curve<Kokkos::Iterate::Morton, Kokkos::Dynamic>(N0, N1, N2);
+    test_curve<Kokkos::Iterate::Hilbert, Kokkos::Static>(N0, N1, N2);
+    test_curve<Kokkos::Iterate::Hilbert, Kokkos::Dynamic>(N0, N1, N2);
+  }
+};
+
+// Order of the tiles of a 4x4x4 tile grid along a Morton or Hilbert curve
+template <typename ExecSpace>
+struct TestMDRange_3D_CurveOrder {
+  using OrderType = typename Kokkos::View<int **, Kokkos::HostSpace>;
+  using CountType = typename Kokkos::View<int, Kokkos::HostSpace>;
+
+  enum { tile = 2, tiles = 4, num_tiles = tiles * tiles * tiles };
+
+  OrderType order;
+  CountType count;
+
+  TestMDRange_3D_CurveOrder()
+      : order("order", int(num_tiles), 3), count("count") {}
+
+  // Record tile origins in visit order, requires a single thread
+  void operator()(const int i, const int j, const int k) const {
+    if (i % tile == 0 && j % tile == 0 && k % tile == 0) {
+      const int n = count()++;
+      order(n, 0) = i;
+      order(n, 1) = j;
+      order(n, 2) = k;
+    }
+  }
+
+  // Consecutive Hilbert tiles are face neighbours, the n-th Morton tile
+  // interleaves the bits of n with bit zero in the fastest dimension
+  static void check(OrderType const &order, const bool hilbert,
+                    const bool inner_left) {
+    std::vector<int> visited(num_tiles, 0);
+
+    for (int n = 0; n < num_tiles; ++n) {
+      int t[3];
+      for (int d = 0; d < 3; ++d) {
+        ASSERT_EQ(order(n, d) % tile, 0);
+        t[d] = order(n, d) / tile;
+      }
+
+      ASSERT_EQ(visited[(t[0] * tiles + t[1]) * tiles + t[2]]++, 0);
+
+      if (hilbert) {
+        if (0 == n) {
+          ASSERT_EQ(t[0] + t[1] + t[2], 0);
+        } else {
+          int distance = 0;
+          for (int d = 0; d < 3; ++d) {
+            distance += std::abs(t[d] - order(n - 1, d) / tile);
+          }
+          ASSERT_EQ(distance, 1);
+        }
+      } else {
+        int expect[3] = {0, 0, 0};
+        for (int b = 0; b < 3; ++b) {
+          const int d = inner_left ? b : 2 - b;
+          for (int level = 0; (1 << level) < tiles; ++level) {
+            expect[d] |= ((n >> (3 * level + b)) & 1) << level;
+          }
+        }
+        for (int d = 0; d < 3; ++d) ASSERT_EQ(t[d], expect[d]);
+      }
+    }
+  }
+
+  template <Kokkos::Iterate OuterDir, Kokkos::Iterate InnerDir>
+  static void test_order() {
+    typedef typename Kokkos::MDRangePolicy<
+        Kokkos::DefaultHostExecutionSpace,
+        Kokkos::Rank<3, OuterDir, InnerDir>, Kokkos::IndexType<int> >
+        range_type;
+    typedef typename range_type::tile_type tile_type;
+    typedef typename range_type::point_type point_type;
+
+    const bool hilbert    = OuterDir == Kokkos::Iterate::Hilbert;
+    const bool inner_left = InnerDir == Kokkos::Iterate::Left;
+
+    const int N = tile * tiles;
+
+    range_type range(point_type{{0, 0, 0}}, point_type{{N, N, N}},
+                     tile_type{{tile, tile, tile}});
+
+    ASSERT_EQ(range.m_num_tiles, num_tiles);
+
+    // Tile order as visited by a single thread
+    OrderType order("order", int(num_tiles), 3);
+    for (int n = 0; n < num_tiles; ++n) {
+      point_type offset;
+      Kokkos::Impl::host_tile_offset(range, n, offset);
+      for (int d = 0; d < 3; ++d) order(n, d) = offset[d];
+    }
+    check(order, hilbert, inner_left);
+
+#ifdef KOKKOS_ENABLE_SERIAL
+    // Tile order of an actual launch
+    if (std::is_same<ExecSpace, Kokkos::Serial>::value) {
+      typedef typename Kokkos::MDRangePolicy<
+          Kokkos::Serial, Kokkos::Rank<3, OuterDir, InnerDir>,
+          Kokkos::IndexType<int> >
+          serial_range_type;
+
+      TestMDRange_3D_CurveOrder functor;
+      parallel_for(
+          serial_range_type(point_type{{0, 0, 0}}, point_type{{N, N, N}},
+                            tile_type{{tile, tile, tile}}),
+          functor);
+      ASSERT_EQ(functor.count(), int(num_tiles));
+      check(functor.order, hilbert, inner_left);
+    }
+#endif
+  }
+
+  static void test_order3() {
+    test_order<Kokkos::Iterate::Morton, Kokkos::Iterate::Right>();
+    test_order<Kokkos::Iterate::Morton, Kokkos::Iterate::Left>();
+    test_order<Kokkos::Iterate::Hilbert, Kokkos::Iterate::Right>();
+    test_order<Kokkos::Iterate::Hilbert, Kokkos::Iterate::Left>();
+  }
+};
+
+template <typename ExecSpace>
+struct TestMDRange_3D_TileSize {
+  using value_type = double;
+
+  using DataType     = int;
+  using ViewType     = typename Kokkos::View<DataType ***, ExecSpace>;
+  using HostViewType = typename ViewType::HostMirror;
+
+  ViewType input_view;
+
+  TestMDRange_3D_TileSize(const DataType N0, const DataType N1,
+                          const DataType N2)
+      : input_view("input_view", N0, N1, N2) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    input_view(i, j, k) += 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k,
+                  value_type &lsum) const {
+    lsum += input_view(i, j, k) * 2;
+  }
+
+  template <Kokkos::Iterate Dir>
+  static void test_tile_size(const int N0, const int N1, const int N2) {
+    typedef typename Kokkos::MDRangePolicy<
+        ExecSpace, Kokkos::Rank<3, Dir, Dir, Kokkos::TileSize<4, 8, 16> >,
+        Kokkos::IndexType<int> >
+        range_type;
+    typedef typename range_type::point_type point_type;
+
+    range_type range(point_type{{0, 0, 0}}, point_type{{N0, N1, N2}});
+
+    ASSERT_EQ(range.m_tile[0], 4);
+    ASSERT_EQ(range.m_tile[1], 8);
+    ASSERT_EQ(range.m_tile[2], 16);
+
+    TestMDRange_3D_TileSize functor(N0, N1, N2);
+
+    parallel_for(range, functor);
+
+    double sum = 0.0;
+    parallel_reduce(range, functor, sum);
+
+    ASSERT_EQ(sum, 2 * N0 * N1 * N2);
+
+    HostViewType h_view = Kokkos::create_mirror_view(functor.input_view);
+    Kokkos::deep_copy(h_view, functor.input_view);
+
+    int counter = 0;
+    for (int i = 0; i < N0; ++i) {
+      for (int j = 0; j < N1; ++j) {
+        for (int k = 0; k < N2; ++k) {
+          if (h_view(i, j, k) != 1) {
+            ++counter;
+          }
+        }
+      }
+    }
+
+    ASSERT_EQ(counter, 0);
+  }
+
+  static void test_tile_size3(const int N0, const int N1, const int N2) {
+    test_tile_size<Kokkos::Iterate::Right>(N0, N1, N2);
+    test_tile_size<Kokkos::Iterate::Left>(N0, N1, N2);
+  }
+};
+
 }  // namespace
 
 }  // namespace Test
@@ -64,4 +64,8 @@ TEST(TEST_CATEGORY, mdrange_neg_idx) {
   TestMDRange_6D_NegIdx<TEST_EXECSPACE>::test_6D_negidx(128, 32, 8, 8, 4, 2);
 }
 
+TEST(TEST_CATEGORY, mdrange_tune) {
+  TestMDRange_3D_Tune<TEST_EXECSPACE>::test_tune3(100, 40, 60);
+}
+
 }  // namespace Test
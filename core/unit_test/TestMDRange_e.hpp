@@ -54,4 +54,15 @@ TEST(TEST_CATEGORY, mdrange_4d) {
   TestMDRange_4D<TEST_EXECSPACE>::test_for4(100, 10, 10, 10);
 }
 
+TEST(TEST_CATEGORY, mdrange_curve_order) {
+  TestMDRange_3D_Curve<TEST_EXECSPACE>::test_curve3(100, 37, 60);
+  TestMDRange_3D_CurveOrder<TEST_EXECSPACE>::test_order3();
+}
+
+TEST(TEST_CATEGORY, mdrange_tile_size) {
+  // Extents that are and are not multiples of the tile size
+  TestMDRange_3D_TileSize<TEST_EXECSPACE>::test_tile_size3(64, 32, 64);
+  TestMDRange_3D_TileSize<TEST_EXECSPACE>::test_tile_size3(101, 37, 60);
+}
+
 }  // namespace Test
@@ -42,7 +42,9 @@
 //@HEADER
 */
 
+#include <chrono>
 #include <cstdio>
+#include <thread>
 
 #include <Kokkos_Core.hpp>
 
@@ -373,6 +375,86 @@ struct TestRange {
   }
 };
 
+template <class ExecSpace>
+struct TestFusedFor {
+  typedef Kokkos::View<int *, ExecSpace> view_type;
+
+  struct OffsetTag {};
+
+  // a(i) = i + 1, or i + 1 + offset under OffsetTag
+  struct Fill {
+    view_type a;
+    KOKKOS_INLINE_FUNCTION void operator()(const int i) const { a(i) = i + 1; }
+    KOKKOS_INLINE_FUNCTION void operator()(const OffsetTag &,
+                                           const int i) const {
+      a(i) = i + 1 + 13;
+    }
+  };
+
+  // b(i) = 2 * a(i), reads only the same index of a
+  struct Scale {
+    view_type a, b;
+    KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+      b(i) = 2 * a(i);
+    }
+    KOKKOS_INLINE_FUNCTION void operator()(const OffsetTag &,
+                                           const int i) const {
+      b(i) = 2 * a(i);
+    }
+  };
+
+  // c(i) = b(N - 1 - i) + a(i), reads b at another index
+  struct Reverse {
+    view_type a, b, c;
+    int N;
+    KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+      c(i) = b(N - 1 - i) + a(i);
+    }
+    KOKKOS_INLINE_FUNCTION void operator()(const OffsetTag &,
+                                           const int i) const {
+      c(i) = b(N - 1 - i) + a(i);
+    }
+  };
+
+  int N;
+  view_type a, b, c;
+
+  TestFusedFor(const int N_) : N(N_), a("a", N_), b("b", N_), c("c", N_) {}
+
+  void check(const int offset) {
+    typename view_type::HostMirror host_b = Kokkos::create_mirror_view(b);
+    typename view_type::HostMirror host_c = Kokkos::create_mirror_view(c);
+    Kokkos::deep_copy(host_b, b);
+    Kokkos::deep_copy(host_c, c);
+
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(host_b(i), 2 * (i + 1 + offset));
+      ASSERT_EQ(host_c(i), 2 * (N - i + offset) + (i + 1 + offset));
+    }
+  }
+
+  void test_fused_for() {
+    const Fill fill       = {a};
+    const Scale scale     = {a, b};
+    const Reverse reverse = {a, b, c, N};
+
+    Kokkos::Experimental::fused_for(Kokkos::RangePolicy<ExecSpace>(0, N), fill,
+                                    scale, Kokkos::Experimental::FusedBarrier(),
+                                    reverse);
+    check(0);
+
+    Kokkos::deep_copy(c, 0);
+
+    // Leading and repeated barriers are allowed
+    Kokkos::Experimental::fused_for(
+        "fused_for", Kokkos::RangePolicy<ExecSpace, OffsetTag>(0, N),
+        Kokkos::Experimental::FusedBarrier(), fill, scale,
+        Kokkos::Experimental::FusedBarrier(),
+        Kokkos::Experimental::FusedBarrier(), reverse);
+    check(13);
+  }
+};
+
 }  // namespace
 
 TEST(TEST_CATEGORY, range_for) {
@@ -402,6 +484,34 @@ TEST(TEST_CATEGORY, range_for) {
     TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Dynamic> > f(1001);
     f.test_for();
   }
+
+  {
+    TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Guided> > f(3);
+    f.test_for();
+  }
+  {
+    TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Guided> > f(1001);
+    f.test_for();
+  }
+  {
+    TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Adaptive> > f(1001);
+    for (int i = 0; i < 4; ++i) f.test_for();
+  }
+}
+
+TEST(TEST_CATEGORY, range_fused_for) {
+  {
+    TestFusedFor<TEST_EXECSPACE> f(0);
+    f.test_fused_for();
+  }
+  {
+    TestFusedFor<TEST_EXECSPACE> f(3);
+    f.test_fused_for();
+  }
+  {
+    TestFusedFor<TEST_EXECSPACE> f(1001);
+    f.test_fused_for();
+  }
 }
 
 TEST(TEST_CATEGORY, range_reduce) {
@@ -431,6 +541,29 @@ TEST(TEST_CATEGORY, range_reduce) {
     TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Dynamic> > f(1001);
     f.test_reduce();
   }
+
+  {
+    TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Guided> > f(3);
+    f.test_reduce();
+  }
+  {
+    TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Guided> > f(1001);
+    f.test_reduce();
+  }
+  {
+    TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Adaptive> > f(1001);
+    for (int i = 0; i < 4; ++i) f.test_reduce();
+  }
+}
+
+TEST(TEST_CATEGORY, range_reduce_after_idle) {
+  // Idle host threads block once their spin interval elapses,
+  // the next kernel has to wake them up again.
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    TestRange<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Static> > f(1000);
+    f.test_reduce();
+  }
 }
 
 #ifndef KOKKOS_ENABLE_OPENMPTARGET
@@ -0,0 +1,263 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_SIMD_HPP
+#define TEST_SIMD_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+namespace Test {
+
+template <class T, class Abi, class ExecSpace>
+struct TestSIMDKernel {
+  typedef Kokkos::Experimental::simd<T, Abi> simd_type;
+  typedef typename simd_type::mask_type mask_type;
+  typedef typename simd_type::index_type index_type;
+  typedef Kokkos::View<T*, ExecSpace> view_type;
+  typedef Kokkos::View<T**, Kokkos::LayoutRight, ExecSpace> view_2d_type;
+  typedef Kokkos::View<T*, Kokkos::LayoutStride, ExecSpace> view_stride_type;
+  typedef Kokkos::View<int*, ExecSpace> view_int_type;
+  typedef T value_type;
+
+  int n;
+  view_type x;
+  view_stride_type y;
+  view_type z;
+  view_type w;
+  view_type lane;
+  view_int_type perm;
+
+  TestSIMDKernel(int const arg_n, view_type const& arg_x,
+                 view_2d_type const& arg_y, view_type const& arg_z,
+                 view_type const& arg_w, view_type const& arg_lane,
+                 view_int_type const& arg_perm)
+      : n(arg_n),
+        x(arg_x),
+        y(Kokkos::subview(arg_y, Kokkos::ALL(), 1)),
+        z(arg_z),
+        w(arg_w),
+        lane(arg_lane),
+        perm(arg_perm) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int const i, T& sum) const {
+    using Kokkos::Experimental::element_aligned_tag;
+    using Kokkos::Experimental::where;
+
+    int const base = i * simd_type::size();
+
+    // Lanes past the end of the arrays are masked off.
+    mask_type const active =
+        simd_type(lane.data(), element_aligned_tag()) < simd_type(T(n - base));
+
+    index_type index;
+    for (int k = 0; k < simd_type::size(); ++k) {
+      index[k] = base + k < n ? perm(base + k) : 0;
+    }
+
+    simd_type a(T(0));
+    simd_type b(T(0));
+    where(active, a).copy_from(x.data() + base, element_aligned_tag());
+    where(active, b).gather_from(y, index);
+
+    simd_type const c = Kokkos::Experimental::fma(a, b, simd_type(T(1)));
+    simd_type const d = Kokkos::Experimental::min(
+        Kokkos::Experimental::sqrt(Kokkos::Experimental::abs(c)),
+        simd_type(T(16)));
+
+    where(active, d).copy_to(z.data() + base, element_aligned_tag());
+    where(active, a).scatter_to(w, index);
+
+    sum += Kokkos::Experimental::reduce(where(active, a * b));
+  }
+};
+
+template <class T, class Abi, class ExecSpace>
+void test_simd_kernel(int const n) {
+  typedef TestSIMDKernel<T, Abi, ExecSpace> functor_type;
+  typedef typename functor_type::simd_type simd_type;
+
+  int const width = simd_type::size();
+  int const chunk = (n + width - 1) / width;
+
+  typename functor_type::view_type x("x", n);
+  typename functor_type::view_2d_type y("y", n, 2);
+  typename functor_type::view_type z("z", n);
+  typename functor_type::view_type w("w", n);
+  typename functor_type::view_type lane("lane", width);
+  typename functor_type::view_int_type perm("perm", n);
+
+  typename functor_type::view_type::HostMirror hx =
+      Kokkos::create_mirror_view(x);
+  typename functor_type::view_2d_type::HostMirror hy =
+      Kokkos::create_mirror_view(y);
+  typename functor_type::view_type::HostMirror hlane =
+      Kokkos::create_mirror_view(lane);
+  typename functor_type::view_int_type::HostMirror hperm =
+      Kokkos::create_mirror_view(perm);
+
+  for (int j = 0; j < n; ++j) {
+    hx(j)    = T(j % 7) - T(3);
+    hy(j, 0) = T(-1);
+    hy(j, 1) = T(j % 5);
+    // A permutation of [0,n) which crosses vector boundaries
+    hperm(j) = (j * 7) % n;
+  }
+  for (int k = 0; k < width; ++k) hlane(k) = T(k);
+
+  Kokkos::deep_copy(x, hx);
+  Kokkos::deep_copy(y, hy);
+  Kokkos::deep_copy(lane, hlane);
+  Kokkos::deep_copy(perm, hperm);
+
+  T sum = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<ExecSpace>(0, chunk),
+                          functor_type(n, x, y, z, w, lane, perm), sum);
+
+  typename functor_type::view_type::HostMirror hz =
+      Kokkos::create_mirror_view(z);
+  typename functor_type::view_type::HostMirror hw =
+      Kokkos::create_mirror_view(w);
+  Kokkos::deep_copy(hz, z);
+  Kokkos::deep_copy(hw, w);
+
+  T sum_expect = 0;
+  for (int j = 0; j < n; ++j) {
+    T const b = hy(hperm(j), 1);
+    T const d = std::min(T(std::sqrt(std::abs(hx(j) * b + T(1)))), T(16));
+    ASSERT_NEAR(d, hz(j), T(1e-5) * d);
+    ASSERT_EQ(hx(j), hw(hperm(j)));
+    sum_expect += hx(j) * b;
+  }
+  ASSERT_EQ(sum_expect, sum);
+}
+
+template <class T, class Abi>
+void test_simd_host() {
+  typedef Kokkos::Experimental::simd<T, Abi> simd_type;
+  typedef typename simd_type::mask_type mask_type;
+
+  using Kokkos::Experimental::element_aligned_tag;
+  using Kokkos::Experimental::where;
+
+  int const width = simd_type::size();
+
+  std::vector<T> lane(width);
+  for (int k = 0; k < width; ++k) lane[k] = T(k + 1);
+
+  simd_type const a(lane.data(), element_aligned_tag());
+  simd_type const b(T(2));
+
+  simd_type c = -(a * b + a - b) / b;
+  c += T(1);
+  for (int k = 0; k < width; ++k) {
+    ASSERT_EQ(T(1) - T(3 * (k + 1) - 2) / T(2), c[k]);
+  }
+
+  mask_type const lt = a < b;
+  mask_type const ge = a >= b;
+  ASSERT_EQ(1, Kokkos::Experimental::popcount(lt));
+  ASSERT_EQ(width - 1, Kokkos::Experimental::popcount(ge));
+  ASSERT_TRUE(Kokkos::Experimental::all_of(lt || ge));
+  ASSERT_TRUE(Kokkos::Experimental::none_of(lt && ge));
+  ASSERT_TRUE(Kokkos::Experimental::any_of(a == b) == (width > 1));
+  ASSERT_TRUE(ge == !lt);
+  ASSERT_TRUE((a != b) == !(a == b));
+  ASSERT_TRUE(Kokkos::Experimental::all_of(mask_type(true)));
+  ASSERT_TRUE(Kokkos::Experimental::none_of(mask_type(false)));
+  for (int k = 0; k < width; ++k) {
+    ASSERT_EQ(k == 0, lt[k]);
+    ASSERT_EQ(k <= 1, (a <= b)[k]);
+    ASSERT_EQ(k >= 2, (a > b)[k]);
+  }
+
+  ASSERT_EQ(T(width * (width + 1) / 2), Kokkos::Experimental::reduce(a));
+  ASSERT_EQ(T(1), Kokkos::Experimental::hmin(a));
+  ASSERT_EQ(T(width), Kokkos::Experimental::hmax(a));
+  ASSERT_EQ(T(width * (width + 1) / 2 - 1),
+            Kokkos::Experimental::reduce(where(ge, a)));
+  ASSERT_EQ(T(width > 1 ? 2 : Kokkos::reduction_identity<T>::min()),
+            Kokkos::Experimental::hmin(where(ge, a)));
+  ASSERT_EQ(T(1), Kokkos::Experimental::hmax(where(lt, a)));
+
+  simd_type m = -a;
+  where(lt, m) = b;
+  where(ge, m) *= T(-1);
+  for (int k = 0; k < width; ++k) {
+    ASSERT_EQ(k == 0 ? T(2) : T(k + 1), m[k]);
+  }
+
+  // Masked memory access must not touch the unselected lanes.
+  std::vector<T> out(width, T(-1));
+  where(lt, a).copy_to(out.data(), element_aligned_tag());
+  for (int k = 0; k < width; ++k) ASSERT_EQ(k == 0 ? T(1) : T(-1), out[k]);
+}
+
+template <class T, class ExecSpace>
+void test_simd() {
+  typedef typename Kokkos::Experimental::native_simd_abi<T, ExecSpace>::type
+      native_abi;
+
+  test_simd_host<T, Kokkos::Experimental::simd_abi::scalar>();
+  test_simd_host<T, Kokkos::Experimental::simd_abi::host_native>();
+
+  test_simd_kernel<T, Kokkos::Experimental::simd_abi::scalar, ExecSpace>(
+      1000);
+  test_simd_kernel<T, native_abi, ExecSpace>(1000);
+  test_simd_kernel<T, native_abi, ExecSpace>(1003);
+}
+
+TEST(TEST_CATEGORY, simd) {
+  test_simd<double, TEST_EXECSPACE>();
+  test_simd<float, TEST_EXECSPACE>();
+}
+
+}  // namespace Test
+
+#endif /* #ifndef TEST_SIMD_HPP */
@@ -133,6 +133,118 @@ struct TestScan {
   }
 };
 
+/** \brief  Scan and reduce of the affine maps x -> a_i * x + b_i.
+ *
+ *  Composition is associative but not commutative, so the result is only
+ *  correct if the partials are joined in the order of the range.  The low
+ *  part of the range is made slower than the rest so that later threads
+ *  look back on partials that are still being published.
+ */
+template <class Device>
+struct TestScanNonCommutative {
+  typedef Device execution_space;
+
+  struct value_type {
+    uint64_t a, b;
+  };
+
+  Kokkos::View<value_type*, Device> expected;
+  Kokkos::View<int, Device, Kokkos::MemoryTraits<Kokkos::Atomic> > errors;
+  int64_t begin, slow_end;
+
+  KOKKOS_INLINE_FUNCTION
+  static value_type map(const int64_t i) {
+    value_type m;
+    m.a = 2 * uint64_t(i) + 3;
+    m.b = uint64_t(i) * uint64_t(i) + 1;
+    return m;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void contribute(const int64_t i, value_type& update) const {
+    if (i < slow_end) {
+      uint64_t volatile spin = 0;
+      for (int k = 0; k < 2000; ++k) spin = spin + k;
+    }
+    const value_type m = map(i);
+    join(update, m);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i, value_type& update,
+                  const bool final_pass) const {
+    contribute(i, update);
+    if (final_pass) {
+      const value_type& e = expected(i - begin);
+      if (e.a != update.a || e.b != update.b) errors()++;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i, value_type& update) const {
+    contribute(i, update);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& update) const {
+    update.a = 1;
+    update.b = 0;
+  }
+
+  // Apply 'update' first, then 'input'
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& update,
+            volatile const value_type& input) const {
+    update.b = input.a * update.b + input.b;
+    update.a = input.a * update.a;
+  }
+
+  TestScanNonCommutative(const int64_t arg_begin, const int64_t arg_end)
+      : expected("expected", arg_end - arg_begin),
+        errors("errors"),
+        begin(arg_begin),
+        slow_end(arg_begin + (arg_end - arg_begin) / 4) {
+    typedef Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t> >
+        policy_type;
+
+    typename Kokkos::View<value_type*, Device>::HostMirror h_expected =
+        Kokkos::create_mirror_view(expected);
+
+    value_type total;
+    init(total);
+    for (int64_t i = arg_begin; i < arg_end; ++i) {
+      const value_type m = map(i);
+      join(total, m);
+      h_expected(i - arg_begin) = total;
+    }
+    Kokkos::deep_copy(expected, h_expected);
+
+    Kokkos::parallel_scan(policy_type(arg_begin, arg_end), *this);
+    Kokkos::fence();
+
+    value_type reduced;
+    Kokkos::parallel_reduce(policy_type(arg_begin, arg_end), *this, reduced);
+
+    int total_errors;
+    Kokkos::deep_copy(total_errors, errors);
+    [&] {
+      ASSERT_EQ(total_errors, 0);
+      ASSERT_EQ(reduced.a, total.a);
+      ASSERT_EQ(reduced.b, total.b);
+    }();
+  }
+};
+
+TEST(TEST_CATEGORY, scan_reduce_noncommutative) {
+  // Lengths that do not divide evenly among the threads
+  for (int64_t n = 1; n < 40; n += 3) {
+    (void)TestScanNonCommutative<TEST_EXECSPACE>(0, n);
+  }
+  for (int i = 0; i < 20; ++i) {
+    (void)TestScanNonCommutative<TEST_EXECSPACE>(7, 1013 + 97 * i);
+  }
+}
+
 TEST(TEST_CATEGORY, scan) {
   TestScan<TEST_EXECSPACE>::test_range(1, 1000);
   TestScan<TEST_EXECSPACE>(0);
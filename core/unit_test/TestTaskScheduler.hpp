@@ -49,6 +49,7 @@
 #if defined(KOKKOS_ENABLE_TASKDAG)
 #include <Kokkos_Core.hpp>
 #include <impl/Kokkos_FixedBufferMemoryPool.hpp>
+#include <impl/Kokkos_TaskTracer.hpp>
 #include <cstdio>
 #include <iostream>
 #include <cmath>
@@ -816,6 +817,51 @@ struct TestMultipleDependence {
 
 //----------------------------------------------------------------------------
 
+namespace TestTaskScheduler {
+
+// Host task queue specializations that record a TaskTracer timeline
+template <class Space>
+struct TaskTraceIsInstrumented : std::false_type {};
+#if defined(KOKKOS_ENABLE_SERIAL)
+template <>
+struct TaskTraceIsInstrumented<Kokkos::Serial> : std::true_type {};
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP)
+template <>
+struct TaskTraceIsInstrumented<Kokkos::OpenMP> : std::true_type {};
+#endif
+
+template <class Scheduler>
+struct TestTaskTrace {
+  static void run() {
+    using execution_space = typename Scheduler::execution_space;
+
+    // Collect statistics only; no trace file is written
+    Kokkos::Impl::TaskTracer::enable("");
+
+    TestFib<Scheduler>::run(10, 11 * 11 * 64000);
+
+    const auto stats = Kokkos::Impl::TaskTracer::statistics();
+
+    Kokkos::Impl::TaskTracer::disable();
+
+    ASSERT_FALSE(Kokkos::Impl::TaskTracer::is_enabled());
+
+    if (TaskTraceIsInstrumented<execution_space>::value) {
+      // fib(10) spawns 177 tasks, each non-leaf task is respawned once
+      ASSERT_GE(stats.task_count, 177u);
+      ASSERT_GE(stats.pop_attempt, stats.task_count);
+      ASSERT_GE(stats.steal_attempt, stats.steal_success);
+      ASSERT_GT(stats.max_depth, 0);
+      ASSERT_GT(stats.execute_seconds, 0.0);
+    }
+  }
+};
+
+}  // namespace TestTaskScheduler
+
+//----------------------------------------------------------------------------
+
 #define KOKKOS_PP_CAT_IMPL(x, y) x##y
 #define KOKKOS_TEST_WITH_SUFFIX(x, y) KOKKOS_PP_CAT_IMPL(x, y)
 
@@ -77,6 +77,11 @@ TEST(TEST_CATEGORY,
   }
 }
 
+TEST(TEST_CATEGORY,
+     KOKKOS_TEST_WITH_SUFFIX(task_trace, TEST_SCHEDULER_SUFFIX)) {
+  TestTaskScheduler::TestTaskTrace<TEST_SCHEDULER>::run();
+}
+
 TEST(TEST_CATEGORY,
      KOKKOS_TEST_WITH_SUFFIX(task_scheduler_ctors, TEST_SCHEDULER_SUFFIX)) {
   TEST_SCHEDULER sched;
@@ -761,6 +761,79 @@ struct functor_vec_red_reducer {
   }
 };
 
+template <typename Scalar, class ExecutionSpace>
+struct functor_vec_red_lanes {
+  typedef Kokkos::TeamPolicy<ExecutionSpace> policy_type;
+  typedef ExecutionSpace execution_space;
+  typedef Kokkos::MinLoc<int, int> minloc_type;
+
+  Kokkos::View<int, Kokkos::LayoutLeft, ExecutionSpace> flag;
+
+  functor_vec_red_lanes(
+      Kokkos::View<int, Kokkos::LayoutLeft, ExecutionSpace> flag_)
+      : flag(flag_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(typename policy_type::member_type team) const {
+    // Host back-ends reduce vector ranges into interleaved partial results,
+    // cover ranges shorter and longer than twice the number of partials
+    // and every tail length.
+    for (int n = 0; n < 40; ++n) {
+      Scalar value = 0;
+
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(team, n),
+          [&](int i, Scalar &val) { val += i; }, value);
+
+      int max_value = 0;
+
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(team, n),
+          [&](int i, int &val) {
+            if (val < (i * 7) % 41) val = (i * 7) % 41;
+          },
+          Kokkos::Max<int>(max_value));
+
+      typename minloc_type::value_type min_loc;
+
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(team, n),
+          [&](int i, typename minloc_type::value_type &val) {
+            if ((i * 7) % 41 + 1 < val.val) {
+              val.val = (i * 7) % 41 + 1;
+              val.loc = i;
+            }
+          },
+          minloc_type(min_loc));
+
+      Kokkos::single(Kokkos::PerThread(team), [&]() {
+        Scalar test  = 0;
+        int test_max = Kokkos::reduction_identity<int>::max();
+        int test_min = Kokkos::reduction_identity<int>::min();
+        int test_loc = -1;
+
+        for (int i = 0; i < n; ++i) {
+          test += i;
+          if (test_max < (i * 7) % 41) test_max = (i * 7) % 41;
+          if ((i * 7) % 41 + 1 < test_min) {
+            test_min = (i * 7) % 41 + 1;
+            test_loc = i;
+          }
+        }
+
+        if (test != value || test_max != max_value ||
+            (0 < n && (test_min != min_loc.val || test_loc != min_loc.loc))) {
+          printf("FAILED vector_par_reduce_lanes %i %i %i %f %f\n",
+                 team.league_rank(), team.team_rank(), n, (double)test,
+                 (double)value);
+
+          flag() = 1;
+        }
+      });
+    }
+  }
+};
+
 template <typename Scalar, class ExecutionSpace>
 struct functor_vec_scan {
   typedef Kokkos::TeamPolicy<ExecutionSpace> policy_type;
@@ -863,6 +936,10 @@ bool test_scalar(int nteams, int team_size, int test) {
     Kokkos::parallel_for(
         "B", Kokkos::TeamPolicy<ExecutionSpace>(nteams, team_size, 8),
         functor_vec_single<Scalar, ExecutionSpace>(d_flag, 4, 13));
+  } else if (test == 12) {
+    Kokkos::parallel_for(
+        Kokkos::TeamPolicy<ExecutionSpace>(nteams, team_size, 8),
+        functor_vec_red_lanes<Scalar, ExecutionSpace>(d_flag));
   }
 
   Kokkos::deep_copy(h_flag, d_flag);
@@ -1023,6 +1100,7 @@ TEST(TEST_CATEGORY, team_vector) {
   ASSERT_TRUE((TestTeamVector::Test<TEST_EXECSPACE>(9)));
   ASSERT_TRUE((TestTeamVector::Test<TEST_EXECSPACE>(10)));
   ASSERT_TRUE((TestTeamVector::Test<TEST_EXECSPACE>(11)));
+  ASSERT_TRUE((TestTeamVector::Test<TEST_EXECSPACE>(12)));
 }
 #endif
 
@@ -48,15 +48,13 @@
 
 namespace Test {
 
-template <class Space>
+template <class Space, Kokkos::Experimental::UniqueTokenScope Scope>
 class TestUniqueToken {
  public:
   typedef typename Space::execution_space execution_space;
   typedef Kokkos::View<int*, execution_space> view_type;
 
-  Kokkos::Experimental::UniqueToken<
-      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>
-      tokens;
+  Kokkos::Experimental::UniqueToken<execution_space, Scope> tokens;
 
   view_type verify;
   view_type counts;
@@ -129,6 +127,11 @@ class TestUniqueToken {
   }
 };
 
-TEST(TEST_CATEGORY, unique_token) { TestUniqueToken<TEST_EXECSPACE>::run(); }
+TEST(TEST_CATEGORY, unique_token) {
+  TestUniqueToken<TEST_EXECSPACE,
+                  Kokkos::Experimental::UniqueTokenScope::Global>::run();
+  TestUniqueToken<TEST_EXECSPACE,
+                  Kokkos::Experimental::UniqueTokenScope::Instance>::run();
+}
 
 }  // namespace Test
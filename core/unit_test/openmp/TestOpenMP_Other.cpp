@@ -47,6 +47,9 @@
 #include <TestTemplateMetaFunctions.hpp>
 #include <TestAggregate.hpp>
 #include <TestMemoryPool.hpp>
+#include <TestConcurrentBitset.hpp>
+#include <TestHostThreadTeam.hpp>
+#include <TestSIMD.hpp>
 #include <TestCXX11.hpp>
 #include <TestTile.hpp>
 
@@ -151,4 +154,157 @@ TEST(openmp, partition_master) {
   ASSERT_EQ(errors, 0);
 }
 
+namespace {
+
+// All of the work is at the beginning of the range
+struct TestAdaptiveImbalance {
+  Kokkos::View<int*, Kokkos::OpenMP> count;
+  int heavy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    if (i < heavy) {
+      int volatile spin = 0;
+      for (int k = 0; k < 20000; ++k) spin = spin + 1;
+    }
+    count(i) += 1;
+  }
+};
+
+}  // namespace
+
+TEST(openmp, adaptive_schedule) {
+  typedef Kokkos::RangePolicy<Kokkos::OpenMP,
+                              Kokkos::Schedule<Kokkos::Adaptive> >
+      policy_type;
+  typedef Kokkos::Impl::ParallelFor<TestAdaptiveImbalance, policy_type,
+                                    Kokkos::OpenMP>
+      closure_type;
+
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+  const int pool_size = Kokkos::OpenMP::thread_pool_size();
+#else
+  const int pool_size = Kokkos::OpenMP::impl_thread_pool_size();
+#endif
+
+  const int N     = 4096;
+  const int chunk = 64;
+
+  TestAdaptiveImbalance f;
+  f.count = Kokkos::View<int*, Kokkos::OpenMP>("count", N);
+  f.heavy = N / 16;
+
+  // The state is shared by every launch of this functor type
+  Kokkos::Impl::HostAdaptiveChunk& adaptive = closure_type::adaptive_chunk();
+  ASSERT_EQ(adaptive.current(), 0);
+
+  const int launches = 3;
+  for (int i = 0; i < launches; ++i) {
+    Kokkos::parallel_for(policy_type(0, N, Kokkos::ChunkSize(chunk)), f);
+  }
+
+  for (int i = 0; i < N; ++i) ASSERT_EQ(f.count(i), launches);
+
+  // How far the chunk moves depends on the timing of the host, which is
+  // noisy when oversubscribed, only its bounds are certain.  A single
+  // thread never tunes it.
+  if (1 < pool_size) {
+    const int64_t max_chunk = std::max<int64_t>(chunk, N / (4 * pool_size));
+    ASSERT_GE(adaptive.current(), 1);
+    ASSERT_LE(adaptive.current(), max_chunk);
+  } else {
+    ASSERT_EQ(adaptive.current(), chunk);
+  }
+}
+
+TEST(openmp, persistent_workers) {
+  Kokkos::Impl::OpenMPExec* const instance = Kokkos::Impl::t_openmp_instance;
+
+  const bool was_persistent = instance->is_persistent();
+
+  instance->start_persistent();
+
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+  const int pool_size = Kokkos::OpenMP::thread_pool_size();
+#else
+  const int pool_size = Kokkos::OpenMP::impl_thread_pool_size();
+#endif
+
+  ASSERT_EQ(instance->is_persistent(), 1 < pool_size);
+  ASSERT_FALSE(Kokkos::OpenMP::in_parallel());
+
+  const int N = 100000;
+
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    int errors = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<Kokkos::OpenMP>(0, N),
+        [pool_size](const int, int& errs) {
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+          const int rank = Kokkos::OpenMP::thread_pool_rank();
+          const int size = Kokkos::OpenMP::thread_pool_size();
+#else
+          const int rank = Kokkos::OpenMP::impl_thread_pool_rank();
+          const int size = Kokkos::OpenMP::impl_thread_pool_size();
+#endif
+          if (!Kokkos::OpenMP::in_parallel() || size != pool_size ||
+              rank < 0 || pool_size <= rank) {
+            ++errs;
+          }
+        },
+        errors);
+    ASSERT_EQ(errors, 0);
+
+    long sum = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<Kokkos::OpenMP, Kokkos::Schedule<Kokkos::Dynamic> >(
+            0, N),
+        [](const int i, long& update) { update += i; }, sum);
+    ASSERT_EQ(sum, long(N) * (N - 1) / 2);
+
+    long total = 0;
+    Kokkos::View<long*, Kokkos::OpenMP> prefix("prefix", N);
+    Kokkos::parallel_scan(Kokkos::RangePolicy<Kokkos::OpenMP>(0, N),
+                          [=](const int i, long& update, const bool final) {
+                            if (final) prefix(i) = update;
+                            update += i;
+                          },
+                          total);
+    ASSERT_EQ(total, long(N) * (N - 1) / 2);
+    ASSERT_EQ(prefix(N - 1), long(N - 1) * (N - 2) / 2);
+
+    Kokkos::Experimental::UniqueToken<Kokkos::OpenMP> token;
+    Kokkos::View<int*, Kokkos::OpenMP> count("count", token.size());
+    Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::OpenMP>(0, N),
+                         [=](const int) {
+                           const int i = token.acquire();
+                           ++count[i];
+                           token.release(i);
+                         });
+    int hits = 0;
+    for (int i = 0; i < token.size(); ++i) hits += count[i];
+    ASSERT_EQ(hits, N);
+
+    typedef Kokkos::TeamPolicy<Kokkos::OpenMP>::member_type member_type;
+    long team_sum = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamPolicy<Kokkos::OpenMP>(N / 100, Kokkos::AUTO),
+        [](const member_type& team, long& update) {
+          long value = 0;
+          Kokkos::parallel_reduce(
+              Kokkos::TeamThreadRange(team, 100),
+              [&](const int j, long& inner) {
+                inner += team.league_rank() * 100 + j;
+              },
+              value);
+          Kokkos::single(Kokkos::PerTeam(team), [&]() { update += value; });
+        },
+        team_sum);
+    ASSERT_EQ(team_sum, long(N) * (N - 1) / 2);
+  }
+
+  if (!was_persistent) instance->stop_persistent();
+  ASSERT_EQ(instance->is_persistent(), was_persistent);
+}
+
 }  // namespace Test
@@ -47,6 +47,9 @@
 #include <TestTemplateMetaFunctions.hpp>
 #include <TestAggregate.hpp>
 #include <TestMemoryPool.hpp>
+#include <TestConcurrentBitset.hpp>
+#include <TestHostThreadTeam.hpp>
+#include <TestSIMD.hpp>
 #include <TestCXX11.hpp>
 #include <TestTile.hpp>
 
@@ -47,6 +47,8 @@
 #include <TestTemplateMetaFunctions.hpp>
 #include <TestAggregate.hpp>
 #include <TestMemoryPool.hpp>
+#include <TestConcurrentBitset.hpp>
+#include <TestSIMD.hpp>
 #include <TestCXX11.hpp>
 #include <TestTile.hpp>
 